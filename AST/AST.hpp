@@ -6,15 +6,64 @@
 #define PL0_COMPILER_AST_HPP
 
 #include <string>
+#include <sstream>
+#include <ostream>
+#include "../Parser/Location.hpp"
 
 namespace AST {
 
     class ASTNode
     {
+        protected:
+            // Offset of the node's first token in its SourceFile. Resolved
+            // to file:line:column only when a diagnostic is printed.
+            int position = Parser::NO_POSITION;
+
+            // Ends the current line and indents the next one by `indent`
+            // levels.
+            static void newline(std::ostream &os, int indent)
+            {
+                os.put('\n');
+                for (int i = 0; i < indent; i++)
+                    os.write("    ", 4);
+            }
+
+            // Writes `s` as a JSON string literal.
+            static void quote(std::ostream &os, const std::string &s)
+            {
+                os.put('"');
+                for (char c: s) {
+                    if (c == '"' || c == '\\')
+                        os.put('\\');
+                    os.put(c);
+                }
+                os.put('"');
+            }
+
         public:
             virtual ~ASTNode() = default;
             virtual void accept(class Visitor &visitor) = 0;
-            [[nodiscard]] virtual std::string toString() const = 0;
+
+            [[nodiscard]] int getPosition() const
+            { return position; }
+
+            void setPosition(int offset)
+            { position = offset; }
+
+            // Writes the node and its children straight into `os`. The
+            // caller has already positioned the first line; continuation
+            // lines are indented by `indent` levels.
+            virtual void print(std::ostream &os, int indent) const = 0;
+
+            // Writes the node and its children as a compact JSON object.
+            virtual void dump(std::ostream &os) const = 0;
+
+            [[nodiscard]] std::string toString() const
+            {
+                std::ostringstream oss;
+                print(oss, 0);
+                return oss.str();
+            }
     };
 
 }
@@ -46,8 +46,11 @@ namespace AST {
             [[nodiscard]] int getValue() const
             { return value; }
 
-            [[nodiscard]] std::string toString() const override
-            { return std::to_string(value); }
+            void print(std::ostream &os, int /*indent*/) const override
+            { os << value; }
+
+            void dump(std::ostream &os) const override
+            { os << "{\"kind\":\"Constant\",\"value\":" << value << '}'; }
     };
 
     class VariableExpression : public ExpressionNode
@@ -66,8 +69,15 @@ namespace AST {
             [[nodiscard]] const std::string &getName() const
             { return name; }
 
-            [[nodiscard]] std::string toString() const override
-            { return name; }
+            void print(std::ostream &os, int /*indent*/) const override
+            { os << name; }
+
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"Variable\",\"name\":";
+                quote(os, name);
+                os << '}';
+            }
     };
 
     class BinaryExpression : public ExpressionNode
@@ -98,8 +108,23 @@ namespace AST {
             [[nodiscard]] const ExpressionNode &getRight() const
             { return *right; }
 
-            [[nodiscard]] std::string toString() const override
-            { return left->toString() + " " + op + " " + right->toString(); }
+            void print(std::ostream &os, int indent) const override
+            {
+                left->print(os, indent);
+                os << ' ' << op << ' ';
+                right->print(os, indent);
+            }
+
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"Binary\",\"op\":";
+                quote(os, op);
+                os << ",\"left\":";
+                left->dump(os);
+                os << ",\"right\":";
+                right->dump(os);
+                os << '}';
+            }
     };
 
     class UnaryExpression : public ExpressionNode
@@ -124,8 +149,20 @@ namespace AST {
             [[nodiscard]] const ExpressionNode &getExpression() const
             { return *expression; }
 
-            [[nodiscard]] std::string toString() const override
-            { return op + expression->toString(); }
+            void print(std::ostream &os, int indent) const override
+            {
+                os << op;
+                expression->print(os, indent);
+            }
+
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"Unary\",\"op\":";
+                quote(os, op);
+                os << ",\"expression\":";
+                expression->dump(os);
+                os << '}';
+            }
     };
 }
 #endif //PL0_COMPILER_EXPRESSIONNODE_HPP
@@ -7,6 +7,9 @@
 
 #include "AST.hpp"
 #include "Visitor.hpp"
+#include <stdexcept>
+#include <memory>
+#include <vector>
 
 namespace AST {
 
@@ -27,6 +30,14 @@ namespace AST {
                 }
             }
     };
+}
+
+// StatementNode.hpp includes this header after defining StatementNode, and
+// its CallStatement needs ProcedureNode; Procedure in turn needs the
+// complete StatementNode, so it is defined after the include below.
+#include "StatementNode.hpp"
+
+namespace AST {
 
     class Procedure : public ProcedureNode
     {
@@ -51,15 +62,28 @@ namespace AST {
             getStatements() const
             { return statements; }
 
-            [[nodiscard]] std::string toString() const override
+            void print(std::ostream &os, int indent) const override
             {
-                std::ostringstream oss;
-                oss << "procedure " << name << " {" << std::endl;
+                os << "procedure " << name << " {";
                 for (const auto &statement: statements) {
-                    oss << statement->toString() << std::endl;
+                    newline(os, indent + 1);
+                    statement->print(os, indent + 1);
+                }
+                newline(os, indent);
+                os << '}';
+            }
+
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"Procedure\",\"name\":";
+                quote(os, name);
+                os << ",\"statements\":[";
+                for (std::size_t i = 0; i < statements.size(); i++) {
+                    if (i)
+                        os << ',';
+                    statements[i]->dump(os);
                 }
-                oss << "}" << std::endl;
-                return oss.str();
+                os << "]}";
             }
     };
 }
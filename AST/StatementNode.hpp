@@ -7,11 +7,10 @@
 
 #include "AST.hpp"
 #include "Visitor.hpp"
-#include "ProcedureNode.hpp"
+#include "ExpressionNode.hpp"
 #include <stdexcept>
 #include <memory>
 #include <vector>
-#include <sstream>
 
 namespace AST {
 
@@ -32,6 +31,13 @@ namespace AST {
                 }
             }
     };
+}
+
+// CallStatement needs the complete ProcedureNode, and ProcedureNode.hpp
+// needs StatementNode, so the include sits between the two.
+#include "ProcedureNode.hpp"
+
+namespace AST {
 
     class AssignmentStatement : public StatementNode
     {
@@ -55,8 +61,20 @@ namespace AST {
             [[nodiscard]] const ExpressionNode &getExpression() const
             { return *expression; }
 
-            [[nodiscard]] std::string toString() const override
-            { return name + " = " + expression->toString(); }
+            void print(std::ostream &os, int indent) const override
+            {
+                os << name << " = ";
+                expression->print(os, indent);
+            }
+
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"Assignment\",\"name\":";
+                quote(os, name);
+                os << ",\"expression\":";
+                expression->dump(os);
+                os << '}';
+            }
     };
 
     class CallStatement : public StatementNode
@@ -76,8 +94,18 @@ namespace AST {
             [[nodiscard]] const ProcedureNode &getProcedure() const
             { return *procedure; }
 
-            [[nodiscard]] std::string toString() const override
-            { return "CALL " + procedure->toString(); }
+            void print(std::ostream &os, int indent) const override
+            {
+                os << "CALL ";
+                procedure->print(os, indent);
+            }
+
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"Call\",\"procedure\":";
+                procedure->dump(os);
+                os << '}';
+            }
     };
 
     class BlockStatement : public StatementNode
@@ -99,16 +127,26 @@ namespace AST {
             getStatements() const
             { return statements; }
 
-            [[nodiscard]] std::string toString() const override
+            void print(std::ostream &os, int indent) const override
             {
-                std::ostringstream oss;
-
-                oss << "BEGIN" << std::endl;
+                os << "BEGIN";
                 for (const auto &statement: statements) {
-                    oss << statement->toString() << std::endl;
+                    newline(os, indent + 1);
+                    statement->print(os, indent + 1);
                 }
-                oss << "END";
-                return oss.str();
+                newline(os, indent);
+                os << "END";
+            }
+
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"Block\",\"statements\":[";
+                for (std::size_t i = 0; i < statements.size(); i++) {
+                    if (i)
+                        os << ',';
+                    statements[i]->dump(os);
+                }
+                os << "]}";
             }
     };
 
@@ -135,13 +173,22 @@ namespace AST {
             [[nodiscard]] const StatementNode &getThenStatement() const
             { return *then_statement; }
 
-            [[nodiscard]] std::string toString() const override
+            void print(std::ostream &os, int indent) const override
             {
-                std::ostringstream oss;
+                os << "IF ";
+                condition->print(os, indent);
+                os << " THEN";
+                newline(os, indent + 1);
+                then_statement->print(os, indent + 1);
+            }
 
-                oss << "IF " << condition->toString() << " THEN" << std::endl;
-                oss << then_statement->toString();
-                return oss.str();
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"If\",\"condition\":";
+                condition->dump(os);
+                os << ",\"then\":";
+                then_statement->dump(os);
+                os << '}';
             }
     };
 
@@ -174,15 +221,28 @@ namespace AST {
             [[nodiscard]] const StatementNode &getElseStatement() const
             { return *else_statement; }
 
-            [[nodiscard]] std::string toString() const override
+            void print(std::ostream &os, int indent) const override
             {
-                std::ostringstream oss;
+                os << "IF ";
+                condition->print(os, indent);
+                os << " THEN";
+                newline(os, indent + 1);
+                then_statement->print(os, indent + 1);
+                newline(os, indent);
+                os << "ELSE";
+                newline(os, indent + 1);
+                else_statement->print(os, indent + 1);
+            }
 
-                oss << "IF " << condition->toString() << " THEN" << std::endl;
-                oss << then_statement->toString() << std::endl;
-                oss << "ELSE" << std::endl;
-                oss << else_statement->toString();
-                return oss.str();
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"IfElse\",\"condition\":";
+                condition->dump(os);
+                os << ",\"then\":";
+                then_statement->dump(os);
+                os << ",\"else\":";
+                else_statement->dump(os);
+                os << '}';
             }
     };
 
@@ -209,13 +269,22 @@ namespace AST {
             [[nodiscard]] const StatementNode &getStatement() const
             { return *statement; }
 
-            [[nodiscard]] std::string toString() const override
+            void print(std::ostream &os, int indent) const override
             {
-                std::ostringstream oss;
+                os << "WHILE ";
+                condition->print(os, indent);
+                os << " DO";
+                newline(os, indent + 1);
+                statement->print(os, indent + 1);
+            }
 
-                oss << "WHILE " << condition->toString() << " DO" << std::endl;
-                oss << statement->toString();
-                return oss.str();
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"While\",\"condition\":";
+                condition->dump(os);
+                os << ",\"statement\":";
+                statement->dump(os);
+                os << '}';
             }
     };
 
@@ -236,8 +305,18 @@ namespace AST {
             [[nodiscard]] const ExpressionNode &getExpression() const
             { return *expression; }
 
-            [[nodiscard]] std::string toString() const override
-            { return "READ " + expression->toString(); }
+            void print(std::ostream &os, int indent) const override
+            {
+                os << "READ ";
+                expression->print(os, indent);
+            }
+
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"Read\",\"expression\":";
+                expression->dump(os);
+                os << '}';
+            }
     };
 
     class WriteStatement : public StatementNode
@@ -257,8 +336,18 @@ namespace AST {
             [[nodiscard]] const ExpressionNode &getExpression() const
             { return *expression; }
 
-            [[nodiscard]] std::string toString() const override
-            { return "WRITE " + expression->toString(); }
+            void print(std::ostream &os, int indent) const override
+            {
+                os << "WRITE ";
+                expression->print(os, indent);
+            }
+
+            void dump(std::ostream &os) const override
+            {
+                os << "{\"kind\":\"Write\",\"expression\":";
+                expression->dump(os);
+                os << '}';
+            }
     };
 }
 
@@ -6,11 +6,13 @@
 #define PL0_COMPILER_VISITOR_HPP
 
 #include "AST.hpp"
-#include "StatementNode.hpp"
-#include "ExpressionNode.hpp"
 
 namespace AST {
 
+    class ExpressionNode;
+    class StatementNode;
+    class ProcedureNode;
+
     class Visitor
     {
         public:
@@ -0,0 +1,128 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_BITVECTOR_HPP
+#define PL0_COMPILER_BITVECTOR_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+
+namespace Analysis {
+
+    // Fixed-size dense bit set. All set operations work a 64-bit word at a
+    // time over contiguous storage, which the compiler can vectorise.
+    class BitVector
+    {
+            using Word = std::uint64_t;
+            static constexpr std::size_t WORD_BITS = 64;
+
+            std::size_t bits;
+            std::vector<Word> words;
+
+            void clearTail()
+            {
+                if (bits % WORD_BITS)
+                    words.back() &= (Word{1} << (bits % WORD_BITS)) - 1;
+            }
+
+        public:
+            explicit BitVector(std::size_t bits = 0, bool value = false)
+                    : bits(bits)
+                      , words((bits + WORD_BITS - 1) / WORD_BITS,
+                              value ? ~Word{0} : Word{0})
+            {
+                clearTail();
+            }
+
+            [[nodiscard]] std::size_t size() const
+            {
+                return bits;
+            }
+
+            [[nodiscard]] bool test(std::size_t i) const
+            {
+                return (words[i / WORD_BITS] >> (i % WORD_BITS)) & 1;
+            }
+
+            void set(std::size_t i)
+            {
+                words[i / WORD_BITS] |= Word{1} << (i % WORD_BITS);
+            }
+
+            void reset(std::size_t i)
+            {
+                words[i / WORD_BITS] &= ~(Word{1} << (i % WORD_BITS));
+            }
+
+            void setAll()
+            {
+                for (Word &w: words)
+                    w = ~Word{0};
+                clearTail();
+            }
+
+            void resetAll()
+            {
+                for (Word &w: words)
+                    w = 0;
+            }
+
+            BitVector &operator|=(const BitVector &other)
+            {
+                for (std::size_t i = 0; i < words.size(); i++)
+                    words[i] |= other.words[i];
+                return *this;
+            }
+
+            BitVector &operator&=(const BitVector &other)
+            {
+                for (std::size_t i = 0; i < words.size(); i++)
+                    words[i] &= other.words[i];
+                return *this;
+            }
+
+            // this &= ~other
+            void subtract(const BitVector &other)
+            {
+                for (std::size_t i = 0; i < words.size(); i++)
+                    words[i] &= ~other.words[i];
+            }
+
+            // this |= ~other, restricted to the first size() bits.
+            void unionComplement(const BitVector &other)
+            {
+                for (std::size_t i = 0; i < words.size(); i++)
+                    words[i] |= ~other.words[i];
+                clearTail();
+            }
+
+            // this = gen | (in & ~kill), the standard gen/kill transfer
+            // function, in a single pass. Returns whether this changed.
+            bool assignTransfer(const BitVector &gen, const BitVector &in,
+                                const BitVector &kill)
+            {
+                Word changed = 0;
+                for (std::size_t i = 0; i < words.size(); i++) {
+                    Word w = gen.words[i] | (in.words[i] & ~kill.words[i]);
+                    changed |= w ^ words[i];
+                    words[i] = w;
+                }
+                return changed != 0;
+            }
+
+            [[nodiscard]] std::size_t count() const
+            {
+                std::size_t n = 0;
+                for (Word w: words)
+                    n += std::popcount(w);
+                return n;
+            }
+
+            bool operator==(const BitVector &other) const = default;
+    };
+}
+
+#endif //PL0_COMPILER_BITVECTOR_HPP
@@ -0,0 +1,219 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_CALLGRAPH_HPP
+#define PL0_COMPILER_CALLGRAPH_HPP
+
+#include "../AST/ExpressionNode.hpp"
+#include "../AST/StatementNode.hpp"
+#include "../AST/ProcedureNode.hpp"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+
+namespace Analysis {
+
+    // Whole-program call graph over a set of procedures. Procedure 0 is the
+    // main program.
+    //
+    // A Resolver maps a CallStatement to the index of the procedure it
+    // calls, or -1 if it calls none of them. Without one, calls are matched
+    // by name. PL/0 lets nested blocks declare procedures with the same
+    // name, and a name alone cannot tell them apart, so such a call is taken
+    // to reach every procedure with that name. That is conservative: none
+    // of them is reported unreachable.
+    class CallGraph
+    {
+        public:
+            using Resolver = std::function<int(const AST::CallStatement &)>;
+
+        private:
+            std::vector<const AST::Procedure *> procedures;
+            std::vector<std::vector<int>> callees;
+            std::vector<int> component;            // SCC id per procedure
+            std::vector<std::vector<int>> components; // callees before callers
+            std::vector<char> reachable;
+
+            void collectCalls(const AST::StatementNode &node,
+                              const Resolver &resolve,
+                              const std::unordered_map<std::string,
+                                      std::vector<int>> &index,
+                              std::vector<int> &out)
+            {
+                if (auto c = dynamic_cast<const AST::CallStatement *>(&node)) {
+                    if (resolve) {
+                        int target = resolve(*c);
+                        if (target >= 0)
+                            out.push_back(target);
+                    } else if (auto p = dynamic_cast<const AST::Procedure *>(
+                            &c->getProcedure())) {
+                        auto it = index.find(p->getName());
+                        if (it != index.end())
+                            out.insert(out.end(), it->second.begin(),
+                                       it->second.end());
+                    }
+                } else if (auto b = dynamic_cast<const AST::BlockStatement *>(&node)) {
+                    for (const auto &s: b->getStatements())
+                        collectCalls(*s, resolve, index, out);
+                } else if (auto i = dynamic_cast<const AST::IfStatement *>(&node)) {
+                    collectCalls(i->getThenStatement(), resolve, index, out);
+                } else if (auto e = dynamic_cast<const AST::IfElseStatement *>(&node)) {
+                    collectCalls(e->getThenStatement(), resolve, index, out);
+                    collectCalls(e->getElseStatement(), resolve, index, out);
+                } else if (auto w = dynamic_cast<const AST::WhileStatement *>(&node)) {
+                    collectCalls(w->getStatement(), resolve, index, out);
+                }
+            }
+
+            // Tarjan's algorithm, iterative so that deep call chains in
+            // generated programs cannot overflow the native stack. SCCs are
+            // completed callees-first, which is the bottom-up order.
+            void findComponents()
+            {
+                int n = static_cast<int>(procedures.size());
+                std::vector<int> order(n, -1);
+                std::vector<int> low(n, 0);
+                std::vector<char> onStack(n, 0);
+                std::vector<int> stack;
+                std::vector<std::pair<int, std::size_t>> work;
+                int counter = 0;
+
+                component.assign(n, -1);
+                for (int root = 0; root < n; root++) {
+                    if (order[root] >= 0)
+                        continue;
+
+                    work.emplace_back(root, 0);
+                    while (!work.empty()) {
+                        auto &[v, next] = work.back();
+
+                        if (next == 0) {
+                            order[v] = low[v] = counter++;
+                            stack.push_back(v);
+                            onStack[v] = 1;
+                        }
+
+                        if (next < callees[v].size()) {
+                            int w = callees[v][next++];
+                            if (order[w] < 0)
+                                work.emplace_back(w, 0);
+                            else if (onStack[w])
+                                low[v] = std::min(low[v], order[w]);
+                            continue;
+                        }
+
+                        if (low[v] == order[v]) {
+                            components.emplace_back();
+                            int w;
+                            do {
+                                w = stack.back();
+                                stack.pop_back();
+                                onStack[w] = 0;
+                                component[w] = static_cast<int>(components.size()) - 1;
+                                components.back().push_back(w);
+                            } while (w != v);
+                        }
+
+                        int finished = v;
+                        work.pop_back();
+                        if (!work.empty()) {
+                            int parent = work.back().first;
+                            low[parent] = std::min(low[parent], low[finished]);
+                        }
+                    }
+                }
+            }
+
+            void findReachable()
+            {
+                reachable.assign(procedures.size(), 0);
+                if (procedures.empty())
+                    return;
+
+                std::vector<int> stack{0};
+                reachable[0] = 1;
+                while (!stack.empty()) {
+                    int v = stack.back();
+                    stack.pop_back();
+                    for (int w: callees[v]) {
+                        if (!reachable[w]) {
+                            reachable[w] = 1;
+                            stack.push_back(w);
+                        }
+                    }
+                }
+            }
+
+        public:
+            explicit CallGraph(std::vector<const AST::Procedure *> all,
+                               const Resolver &resolve = nullptr)
+                    : procedures(std::move(all))
+                      , callees(procedures.size())
+            {
+                std::unordered_map<std::string, std::vector<int>> index;
+                if (!resolve)
+                    for (std::size_t i = 0; i < procedures.size(); i++)
+                        index[procedures[i]->getName()].push_back(
+                                static_cast<int>(i));
+
+                for (std::size_t i = 0; i < procedures.size(); i++) {
+                    auto &out = callees[i];
+                    for (const auto &s: procedures[i]->getStatements())
+                        collectCalls(*s, resolve, index, out);
+                    std::sort(out.begin(), out.end());
+                    out.erase(std::unique(out.begin(), out.end()), out.end());
+                }
+
+                findComponents();
+                findReachable();
+            }
+
+            [[nodiscard]] const std::vector<int> &getCallees(int procedure) const
+            {
+                return callees[procedure];
+            }
+
+            [[nodiscard]] bool isReachable(int procedure) const
+            {
+                return reachable[procedure];
+            }
+
+            // True if the procedure can call itself, directly or through
+            // other procedures.
+            [[nodiscard]] bool isRecursive(int procedure) const
+            {
+                const auto &c = callees[procedure];
+                return components[component[procedure]].size() > 1 ||
+                       std::binary_search(c.begin(), c.end(), procedure);
+            }
+
+            // Procedures no chain of CALLs from the main program reaches.
+            // These can be dropped before optimisation and code generation.
+            [[nodiscard]] std::vector<const AST::Procedure *> getUnreachable() const
+            {
+                std::vector<const AST::Procedure *> result;
+                for (std::size_t i = 0; i < procedures.size(); i++)
+                    if (!reachable[i])
+                        result.push_back(procedures[i]);
+                return result;
+            }
+
+            // Reachable procedures, every callee before its callers except
+            // within a recursive cycle. Compiling in this order makes
+            // summaries of callees available when their callers are compiled.
+            [[nodiscard]] std::vector<const AST::Procedure *> bottomUpOrder() const
+            {
+                std::vector<const AST::Procedure *> result;
+                for (const auto &scc: components)
+                    for (int p: scc)
+                        if (reachable[p])
+                            result.push_back(procedures[p]);
+                return result;
+            }
+    };
+}
+
+#endif //PL0_COMPILER_CALLGRAPH_HPP
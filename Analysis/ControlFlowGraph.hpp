@@ -0,0 +1,237 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_CONTROLFLOWGRAPH_HPP
+#define PL0_COMPILER_CONTROLFLOWGRAPH_HPP
+
+#include "../AST/ExpressionNode.hpp"
+#include "../AST/StatementNode.hpp"
+#include "../AST/ProcedureNode.hpp"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+
+namespace Analysis {
+
+    struct Access
+    {
+        enum Kind
+        {
+            USE, DEF, CALL
+        };
+
+        Kind kind;
+        int symbol;   // index into the tracked variables, -1 for CALL
+        int position; // source offset of the statement or expression
+    };
+
+    struct BasicBlock
+    {
+        std::vector<Access> accesses; // in execution order
+        std::vector<int> successors;
+        std::vector<int> predecessors;
+    };
+
+    class ControlFlowGraph
+    {
+            std::vector<BasicBlock> blocks;
+            int symbolCount;
+
+        public:
+            explicit ControlFlowGraph(int symbolCount)
+                    : symbolCount(symbolCount)
+            {}
+
+            int addBlock()
+            {
+                blocks.emplace_back();
+                return static_cast<int>(blocks.size()) - 1;
+            }
+
+            void addEdge(int from, int to)
+            {
+                blocks[from].successors.push_back(to);
+                blocks[to].predecessors.push_back(from);
+            }
+
+            BasicBlock &getBlock(int i)
+            {
+                return blocks[i];
+            }
+
+            [[nodiscard]] const BasicBlock &getBlock(int i) const
+            {
+                return blocks[i];
+            }
+
+            [[nodiscard]] int getBlockCount() const
+            {
+                return static_cast<int>(blocks.size());
+            }
+
+            [[nodiscard]] int getSymbolCount() const
+            {
+                return symbolCount;
+            }
+
+            [[nodiscard]] int getEntry() const
+            {
+                return 0;
+            }
+
+            // The builder always creates the exit block last.
+            [[nodiscard]] int getExit() const
+            {
+                return static_cast<int>(blocks.size()) - 1;
+            }
+
+            // Blocks reachable from the entry, in reverse postorder.
+            [[nodiscard]] std::vector<int> reversePostorder() const
+            {
+                std::vector<int> order;
+                std::vector<char> seen(blocks.size(), 0);
+                // (block, next successor index) pairs for an iterative DFS.
+                std::vector<std::pair<int, std::size_t>> stack;
+
+                stack.emplace_back(getEntry(), 0);
+                seen[getEntry()] = 1;
+                while (!stack.empty()) {
+                    auto &[b, next] = stack.back();
+                    const auto &succ = blocks[b].successors;
+
+                    if (next < succ.size()) {
+                        int s = succ[next++];
+                        if (!seen[s]) {
+                            seen[s] = 1;
+                            stack.emplace_back(s, 0);
+                        }
+                    } else {
+                        order.push_back(b);
+                        stack.pop_back();
+                    }
+                }
+
+                return {order.rbegin(), order.rend()};
+            }
+    };
+
+    // Lowers a procedure body into basic blocks of variable accesses.
+    // Only the variables passed to the constructor are tracked; their index
+    // in that list is their symbol number. Any other name (constants,
+    // procedures) is ignored.
+    //
+    // A CALL may read or write variables through a nested procedure, so it
+    // is recorded as a CALL access rather than as individual uses.
+    class ControlFlowGraphBuilder
+    {
+            std::unordered_map<std::string, int> symbols;
+            ControlFlowGraph cfg;
+            int current;
+
+            void use(const AST::ExpressionNode &expression)
+            {
+                if (auto v = dynamic_cast<const AST::VariableExpression *>(&expression)) {
+                    auto it = symbols.find(v->getName());
+                    if (it != symbols.end())
+                        cfg.getBlock(current).accesses.push_back(
+                                {Access::USE, it->second, v->getPosition()});
+                } else if (auto b = dynamic_cast<const AST::BinaryExpression *>(&expression)) {
+                    use(b->getLeft());
+                    use(b->getRight());
+                } else if (auto u = dynamic_cast<const AST::UnaryExpression *>(&expression)) {
+                    use(u->getExpression());
+                }
+            }
+
+            void define(const std::string &name, int position)
+            {
+                auto it = symbols.find(name);
+                if (it != symbols.end())
+                    cfg.getBlock(current).accesses.push_back(
+                            {Access::DEF, it->second, position});
+            }
+
+            int startBlock()
+            {
+                current = cfg.addBlock();
+                return current;
+            }
+
+            void statement(const AST::StatementNode &node)
+            {
+                if (auto a = dynamic_cast<const AST::AssignmentStatement *>(&node)) {
+                    use(a->getExpression());
+                    define(a->getName(), a->getPosition());
+                } else if (auto r = dynamic_cast<const AST::ReadStatement *>(&node)) {
+                    auto v = dynamic_cast<const AST::VariableExpression *>(&r->getExpression());
+                    if (!v)
+                        throw std::invalid_argument("READ target must be a variable");
+                    define(v->getName(), r->getPosition());
+                } else if (auto w = dynamic_cast<const AST::WriteStatement *>(&node)) {
+                    use(w->getExpression());
+                } else if (dynamic_cast<const AST::CallStatement *>(&node)) {
+                    cfg.getBlock(current).accesses.push_back(
+                            {Access::CALL, -1, node.getPosition()});
+                } else if (auto b = dynamic_cast<const AST::BlockStatement *>(&node)) {
+                    for (const auto &s: b->getStatements())
+                        statement(*s);
+                } else if (auto i = dynamic_cast<const AST::IfStatement *>(&node)) {
+                    use(i->getCondition());
+                    int head = current;
+                    cfg.addEdge(head, startBlock());
+                    statement(i->getThenStatement());
+                    int thenEnd = current;
+                    int join = startBlock();
+                    cfg.addEdge(head, join);
+                    cfg.addEdge(thenEnd, join);
+                } else if (auto e = dynamic_cast<const AST::IfElseStatement *>(&node)) {
+                    use(e->getCondition());
+                    int head = current;
+                    cfg.addEdge(head, startBlock());
+                    statement(e->getThenStatement());
+                    int thenEnd = current;
+                    cfg.addEdge(head, startBlock());
+                    statement(e->getElseStatement());
+                    int elseEnd = current;
+                    int join = startBlock();
+                    cfg.addEdge(thenEnd, join);
+                    cfg.addEdge(elseEnd, join);
+                } else if (auto l = dynamic_cast<const AST::WhileStatement *>(&node)) {
+                    int before = current;
+                    int header = startBlock();
+                    cfg.addEdge(before, header);
+                    use(l->getCondition());
+                    cfg.addEdge(header, startBlock());
+                    statement(l->getStatement());
+                    cfg.addEdge(current, header);
+                    cfg.addEdge(header, startBlock());
+                } else {
+                    throw std::invalid_argument("unknown statement: " + node.toString());
+                }
+            }
+
+        public:
+            explicit ControlFlowGraphBuilder(const std::vector<std::string> &variables)
+                    : cfg(static_cast<int>(variables.size()))
+                      , current(0)
+            {
+                for (std::size_t i = 0; i < variables.size(); i++)
+                    symbols.emplace(variables[i], static_cast<int>(i));
+            }
+
+            ControlFlowGraph build(const AST::Procedure &procedure)
+            {
+                startBlock();
+                for (const auto &s: procedure.getStatements())
+                    statement(*s);
+
+                int last = current;
+                cfg.addEdge(last, startBlock());
+                return std::move(cfg);
+            }
+    };
+}
+
+#endif //PL0_COMPILER_CONTROLFLOWGRAPH_HPP
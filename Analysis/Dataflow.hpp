@@ -0,0 +1,196 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_DATAFLOW_HPP
+#define PL0_COMPILER_DATAFLOW_HPP
+
+#include "BitVector.hpp"
+#include "ControlFlowGraph.hpp"
+#include <vector>
+
+namespace Analysis {
+
+    enum class Direction
+    {
+        FORWARD, BACKWARD
+    };
+
+    enum class Meet
+    {
+        UNION, INTERSECTION
+    };
+
+    // A gen/kill problem over a ControlFlowGraph: each block maps its input
+    // set X to gen | (X & ~kill).
+    struct Problem
+    {
+        Direction direction;
+        Meet meet;
+        BitVector boundary;           // value at entry (FORWARD) or exit (BACKWARD)
+        std::vector<BitVector> gen;
+        std::vector<BitVector> kill;
+    };
+
+    struct Solution
+    {
+        std::vector<BitVector> in;  // at block entry
+        std::vector<BitVector> out; // at block exit
+    };
+
+    // Iterative worklist solver. Blocks are seeded in reverse postorder
+    // (postorder for backward problems) so most problems converge in two
+    // passes. Blocks unreachable from the entry keep the meet's top value.
+    inline Solution solve(const ControlFlowGraph &cfg, const Problem &problem)
+    {
+        int n = cfg.getBlockCount();
+        auto bits = static_cast<std::size_t>(cfg.getSymbolCount());
+        bool forward = problem.direction == Direction::FORWARD;
+        bool top = problem.meet == Meet::INTERSECTION;
+        int boundaryBlock = forward ? cfg.getEntry() : cfg.getExit();
+
+        // "before"/"after" are relative to the direction of the analysis.
+        std::vector<BitVector> before(n, BitVector(bits, top));
+        std::vector<BitVector> after(n, BitVector(bits, top));
+
+        std::vector<int> order = cfg.reversePostorder();
+        if (!forward)
+            order.assign(order.rbegin(), order.rend());
+
+        std::vector<int> worklist(order.rbegin(), order.rend());
+        std::vector<char> queued(n, 0);
+        for (int b: order)
+            queued[b] = 1;
+
+        while (!worklist.empty()) {
+            int b = worklist.back();
+            worklist.pop_back();
+            queued[b] = 0;
+
+            const BasicBlock &block = cfg.getBlock(b);
+            const auto &inEdges = forward ? block.predecessors : block.successors;
+            const auto &outEdges = forward ? block.successors : block.predecessors;
+
+            BitVector &input = before[b];
+            if (b == boundaryBlock) {
+                input = problem.boundary;
+            } else {
+                if (top)
+                    input.setAll();
+                else
+                    input.resetAll();
+
+                for (int e: inEdges) {
+                    if (top)
+                        input &= after[e];
+                    else
+                        input |= after[e];
+                }
+            }
+
+            if (after[b].assignTransfer(problem.gen[b], input, problem.kill[b])) {
+                for (int s: outEdges) {
+                    if (!queued[s]) {
+                        queued[s] = 1;
+                        worklist.push_back(s);
+                    }
+                }
+            }
+        }
+
+        if (forward)
+            return {std::move(before), std::move(after)};
+        return {std::move(after), std::move(before)};
+    }
+
+    // Variables that may be read before their next assignment.
+    inline Solution liveness(const ControlFlowGraph &cfg)
+    {
+        int n = cfg.getBlockCount();
+        auto bits = static_cast<std::size_t>(cfg.getSymbolCount());
+        Problem problem{Direction::BACKWARD, Meet::UNION, BitVector(bits),
+                        std::vector<BitVector>(n, BitVector(bits)),
+                        std::vector<BitVector>(n, BitVector(bits))};
+
+        for (int b = 0; b < n; b++) {
+            BitVector &gen = problem.gen[b];
+            BitVector &kill = problem.kill[b];
+
+            for (const Access &a: cfg.getBlock(b).accesses) {
+                if (a.kind == Access::USE && !kill.test(a.symbol))
+                    gen.set(a.symbol);
+                else if (a.kind == Access::DEF)
+                    kill.set(a.symbol);
+                else if (a.kind == Access::CALL)
+                    gen.unionComplement(kill);
+            }
+        }
+
+        return solve(cfg, problem);
+    }
+
+    // Variables assigned on every path from the entry.
+    inline Solution definiteAssignment(const ControlFlowGraph &cfg)
+    {
+        int n = cfg.getBlockCount();
+        auto bits = static_cast<std::size_t>(cfg.getSymbolCount());
+        Problem problem{Direction::FORWARD, Meet::INTERSECTION, BitVector(bits),
+                        std::vector<BitVector>(n, BitVector(bits)),
+                        std::vector<BitVector>(n, BitVector(bits))};
+
+        for (int b = 0; b < n; b++)
+            for (const Access &a: cfg.getBlock(b).accesses)
+                if (a.kind == Access::DEF)
+                    problem.gen[b].set(a.symbol);
+
+        return solve(cfg, problem);
+    }
+
+    // Uses of a variable that is not assigned on every path reaching them.
+    inline std::vector<Access> findUnassignedUses(const ControlFlowGraph &cfg)
+    {
+        Solution assigned = definiteAssignment(cfg);
+        std::vector<Access> result;
+
+        for (int b = 0; b < cfg.getBlockCount(); b++) {
+            BitVector current = assigned.in[b];
+
+            for (const Access &a: cfg.getBlock(b).accesses) {
+                if (a.kind == Access::USE && !current.test(a.symbol))
+                    result.push_back(a);
+                else if (a.kind == Access::DEF)
+                    current.set(a.symbol);
+            }
+        }
+
+        return result;
+    }
+
+    // Assignments whose value is never read.
+    inline std::vector<Access> findDeadStores(const ControlFlowGraph &cfg)
+    {
+        Solution live = liveness(cfg);
+        std::vector<Access> result;
+
+        for (int b = 0; b < cfg.getBlockCount(); b++) {
+            BitVector current = live.out[b];
+            const auto &accesses = cfg.getBlock(b).accesses;
+
+            for (auto it = accesses.rbegin(); it != accesses.rend(); ++it) {
+                if (it->kind == Access::DEF) {
+                    if (!current.test(it->symbol))
+                        result.push_back(*it);
+                    current.reset(it->symbol);
+                } else if (it->kind == Access::USE) {
+                    current.set(it->symbol);
+                } else {
+                    current.setAll();
+                }
+            }
+        }
+
+        return result;
+    }
+}
+
+#endif //PL0_COMPILER_DATAFLOW_HPP
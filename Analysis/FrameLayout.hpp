@@ -0,0 +1,126 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_FRAMELAYOUT_HPP
+#define PL0_COMPILER_FRAMELAYOUT_HPP
+
+#include "BitVector.hpp"
+#include "ControlFlowGraph.hpp"
+#include "Dataflow.hpp"
+#include <vector>
+#include <algorithm>
+
+namespace Analysis {
+
+    // Frame slot assignment for a procedure's local variables. Variables
+    // whose live ranges never overlap share a slot, so the frame is as
+    // small as the interference graph allows under greedy colouring.
+    class FrameLayout
+    {
+            std::vector<int> slots;
+            int frameSize;
+
+        public:
+            FrameLayout(std::vector<int> slots, int frameSize)
+                    : slots(std::move(slots))
+                      , frameSize(frameSize)
+            {}
+
+            [[nodiscard]] int getSlot(int symbol) const
+            {
+                return slots[symbol];
+            }
+
+            // One slot per variable, as Scope::allocVariableSpace hands out.
+            [[nodiscard]] int getUnpackedSize() const
+            {
+                return static_cast<int>(slots.size());
+            }
+
+            [[nodiscard]] int getFrameSize() const
+            {
+                return frameSize;
+            }
+    };
+
+    // Two variables interfere when one is assigned while the other is
+    // live. A nested procedure may use any of the variables, and any two of
+    // them at once, so until there are callee summaries a procedure that
+    // makes a CALL gets no sharing at all: every variable interferes with
+    // every other.
+    inline std::vector<BitVector> interference(const ControlFlowGraph &cfg)
+    {
+        auto n = static_cast<std::size_t>(cfg.getSymbolCount());
+        std::vector<BitVector> graph(n, BitVector(n));
+        bool calls = false;
+        Solution live = liveness(cfg);
+
+        for (int b = 0; b < cfg.getBlockCount(); b++) {
+            BitVector current = live.out[b];
+            const auto &accesses = cfg.getBlock(b).accesses;
+
+            for (auto it = accesses.rbegin(); it != accesses.rend(); ++it) {
+                if (it->kind == Access::DEF) {
+                    graph[it->symbol] |= current;
+                    current.reset(it->symbol);
+                } else if (it->kind == Access::USE) {
+                    current.set(it->symbol);
+                } else {
+                    calls = true;
+                    current.setAll();
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < n; i++) {
+            if (calls)
+                graph[i].setAll();
+            graph[i].reset(i);
+            for (std::size_t j = 0; j < n; j++)
+                if (graph[i].test(j))
+                    graph[j].set(i);
+        }
+
+        return graph;
+    }
+
+    inline FrameLayout layoutFrame(const ControlFlowGraph &cfg)
+    {
+        auto n = static_cast<std::size_t>(cfg.getSymbolCount());
+        std::vector<BitVector> graph = interference(cfg);
+
+        // Most-constrained variables first.
+        std::vector<int> order(n);
+        std::vector<std::size_t> degree(n);
+        for (std::size_t i = 0; i < n; i++) {
+            order[i] = static_cast<int>(i);
+            degree[i] = graph[i].count();
+        }
+        std::stable_sort(order.begin(), order.end(), [&](int lhs, int rhs) {
+            return degree[lhs] > degree[rhs];
+        });
+
+        std::vector<int> slots(n, -1);
+        int frameSize = 0;
+        BitVector taken(n);
+
+        for (int v: order) {
+            taken.resetAll();
+            for (std::size_t u = 0; u < n; u++)
+                if (slots[u] >= 0 && graph[v].test(u))
+                    taken.set(slots[u]);
+
+            int slot = 0;
+            while (taken.test(slot))
+                slot++;
+
+            slots[v] = slot;
+            frameSize = std::max(frameSize, slot + 1);
+        }
+
+        return {std::move(slots), frameSize};
+    }
+}
+
+#endif //PL0_COMPILER_FRAMELAYOUT_HPP
@@ -0,0 +1,373 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_GENERATOR_HPP
+#define PL0_COMPILER_GENERATOR_HPP
+
+#include "../AST/ExpressionNode.hpp"
+#include "../AST/StatementNode.hpp"
+#include "../AST/ProcedureNode.hpp"
+#include <string>
+#include <sstream>
+#include <memory>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+namespace Bench {
+
+    struct GeneratorOptions
+    {
+        int statements = 1000;      // approximate statement count
+        int depth = 3;              // maximum procedure nesting depth
+        int procedures = 4;         // procedures declared per block
+        int variables = 8;          // variables declared per block (>= 1)
+        double constantDensity = 0.3; // chance an operand is a constant
+        double loopIntensity = 0.1; // chance a statement is a WHILE loop
+        std::uint32_t seed = 42;
+    };
+
+    // Produces syntactically valid PL/0 programs of a configurable shape,
+    // either as source text or, until there is a parser, directly as the
+    // main program's AST. Output is deterministic for a given set of options.
+    class ProgramGenerator
+    {
+            GeneratorOptions options;
+            std::mt19937 rng;
+            std::ostringstream out;
+            int remaining;
+            int nextName;
+
+            // Names visible at the current point, innermost block last.
+            std::vector<std::vector<std::string>> variables;
+            std::vector<std::vector<std::string>> constants;
+            std::vector<std::vector<std::string>> procedures;
+            // Loop counters are kept out of `variables` so that no generated
+            // assignment can reset them and keep a loop running forever.
+            std::vector<std::string> counters;
+
+            bool chance(double p)
+            {
+                return std::uniform_real_distribution<double>(0.0, 1.0)(rng) < p;
+            }
+
+            int pick(int n)
+            {
+                return std::uniform_int_distribution<int>(0, n - 1)(rng);
+            }
+
+            const std::string &pickName(
+                    const std::vector<std::vector<std::string>> &scopes)
+            {
+                std::size_t total = 0;
+                for (const auto &names: scopes)
+                    total += names.size();
+
+                int i = pick(static_cast<int>(total));
+                for (const auto &names: scopes) {
+                    if (i < static_cast<int>(names.size()))
+                        return names[i];
+                    i -= static_cast<int>(names.size());
+                }
+
+                return scopes.back().back();
+            }
+
+            static bool empty(const std::vector<std::vector<std::string>> &scopes)
+            {
+                for (const auto &names: scopes)
+                    if (!names.empty())
+                        return false;
+                return true;
+            }
+
+            std::string fresh(char prefix)
+            {
+                return prefix + std::to_string(nextName++);
+            }
+
+            void indent(int n)
+            {
+                for (int i = 0; i < n; i++)
+                    out << "  ";
+            }
+
+            void operand()
+            {
+                if (chance(options.constantDensity) || empty(variables)) {
+                    if (!empty(constants) && chance(0.5))
+                        out << pickName(constants);
+                    else
+                        out << pick(100);
+                } else {
+                    out << pickName(variables);
+                }
+            }
+
+            void expression(int terms)
+            {
+                static const char *ops[] = {"+", "-", "*"};
+
+                operand();
+                for (int i = 1; i < terms; i++) {
+                    out << " " << ops[pick(3)] << " ";
+                    operand();
+                }
+            }
+
+            void condition()
+            {
+                static const char *rels[] = {"=", "#", "<", "<=", ">", ">="};
+
+                if (chance(0.1)) {
+                    out << "ODD ";
+                    expression(1);
+                } else {
+                    expression(1 + pick(2));
+                    out << " " << rels[pick(6)] << " ";
+                    expression(1 + pick(2));
+                }
+            }
+
+            void statement(int level)
+            {
+                remaining--;
+
+                if (remaining > 2 && chance(options.loopIntensity)) {
+                    // Bounded counting loop so generated programs terminate.
+                    const std::string &v = counters.back();
+                    out << v << " := 0;" << std::endl;
+                    indent(level);
+                    out << "WHILE " << v << " < " << 1 + pick(10) << " DO"
+                        << std::endl;
+                    indent(level + 1);
+                    out << "BEGIN" << std::endl;
+                    indent(level + 2);
+                    out << v << " := " << v << " + 1";
+                    int body = 1 + pick(4);
+                    for (int i = 0; i < body && remaining > 0; i++) {
+                        out << ";" << std::endl;
+                        indent(level + 2);
+                        simpleStatement();
+                    }
+                    out << std::endl;
+                    indent(level + 1);
+                    out << "END";
+                } else if (remaining > 1 && chance(0.15)) {
+                    out << "IF ";
+                    condition();
+                    out << " THEN" << std::endl;
+                    indent(level + 1);
+                    simpleStatement();
+                    if (chance(0.5)) {
+                        out << std::endl;
+                        indent(level);
+                        out << "ELSE" << std::endl;
+                        indent(level + 1);
+                        simpleStatement();
+                    }
+                } else {
+                    remaining++;
+                    simpleStatement();
+                }
+            }
+
+            void simpleStatement()
+            {
+                remaining--;
+
+                int kind = pick(10);
+                if (kind == 0 && !empty(procedures)) {
+                    out << "CALL " << pickName(procedures);
+                } else if (kind == 1) {
+                    out << "WRITE ";
+                    expression(1 + pick(2));
+                } else {
+                    out << pickName(variables) << " := ";
+                    expression(1 + pick(4));
+                }
+            }
+
+            void block(int level, int depth, int budget)
+            {
+                variables.emplace_back();
+                constants.emplace_back();
+                procedures.emplace_back();
+
+                int nconst = static_cast<int>(options.variables *
+                                              options.constantDensity);
+                if (nconst > 0) {
+                    indent(level);
+                    out << "CONST ";
+                    for (int i = 0; i < nconst; i++) {
+                        std::string c = fresh('c');
+                        out << (i ? ", " : "") << c << " = " << pick(1000);
+                        constants.back().push_back(std::move(c));
+                    }
+                    out << ";" << std::endl;
+                }
+
+                indent(level);
+                out << "VAR ";
+                for (int i = 0; i < options.variables; i++) {
+                    std::string v = fresh('v');
+                    out << (i ? ", " : "") << v;
+                    variables.back().push_back(std::move(v));
+                }
+                counters.push_back(fresh('i'));
+                out << ", " << counters.back() << ";" << std::endl;
+
+                // Half the budget goes to nested procedures, and only as many
+                // are declared as can have at least one statement each.
+                int nested = depth < options.depth ?
+                             std::min(options.procedures, budget / 2) : 0;
+                int share = nested ? budget / (2 * nested) : 0;
+                for (int i = 0; i < nested && remaining > 0; i++) {
+                    std::string p = fresh('p');
+                    indent(level);
+                    out << "PROCEDURE " << p << ";" << std::endl;
+                    block(level + 2, depth + 1, share);
+                    out << ";" << std::endl;
+                    // Declared after the body: no recursion in generated code.
+                    procedures.back().push_back(std::move(p));
+                }
+
+                indent(level);
+                out << "BEGIN";
+                int stop = remaining - (budget - share * nested);
+                for (bool first = true; remaining > 0 && remaining > stop;
+                     first = false) {
+                    out << (first ? "" : ";") << std::endl;
+                    indent(level + 1);
+                    statement(level + 1);
+                }
+                out << std::endl;
+                indent(level);
+                out << "END";
+
+                counters.pop_back();
+                variables.pop_back();
+                constants.pop_back();
+                procedures.pop_back();
+            }
+
+            // The AST counterparts of the above. Trees have no declarations:
+            // variables are v0, v1, ... and CALLs go to p0, p1, ...; nesting
+            // is WHILE bodies up to `depth` deep.
+            std::unique_ptr<AST::ExpressionNode> treeOperand()
+            {
+                if (chance(options.constantDensity))
+                    return std::make_unique<AST::ConstantExpression>(pick(100));
+                return std::make_unique<AST::VariableExpression>(
+                        "v" + std::to_string(pick(options.variables)));
+            }
+
+            std::unique_ptr<AST::ExpressionNode> treeExpression(int terms)
+            {
+                static const char *ops[] = {"+", "-", "*"};
+
+                auto result = treeOperand();
+                for (int i = 1; i < terms; i++)
+                    result = std::make_unique<AST::BinaryExpression>(
+                            std::move(result), treeOperand(), ops[pick(3)]);
+                return result;
+            }
+
+            std::unique_ptr<AST::ExpressionNode> treeCondition()
+            {
+                static const char *rels[] = {"=", "#", "<", "<=", ">", ">="};
+
+                if (chance(0.1))
+                    return std::make_unique<AST::UnaryExpression>(
+                            treeExpression(1), "ODD ");
+                auto left = treeExpression(1 + pick(2));
+                return std::make_unique<AST::BinaryExpression>(
+                        std::move(left), treeExpression(1 + pick(2)),
+                        rels[pick(6)]);
+            }
+
+            std::unique_ptr<AST::StatementNode> treeSimpleStatement()
+            {
+                remaining--;
+
+                int kind = pick(10);
+                if (kind == 0 && options.procedures > 0) {
+                    return std::make_unique<AST::CallStatement>(
+                            std::make_unique<AST::Procedure>(
+                                    "p" + std::to_string(pick(options.procedures)),
+                                    std::vector<std::unique_ptr<AST::StatementNode>>()));
+                } else if (kind == 1) {
+                    return std::make_unique<AST::WriteStatement>(
+                            treeExpression(1 + pick(2)));
+                }
+                return std::make_unique<AST::AssignmentStatement>(
+                        "v" + std::to_string(pick(options.variables)),
+                        treeExpression(1 + pick(4)));
+            }
+
+            std::unique_ptr<AST::StatementNode> treeStatement(int depth)
+            {
+                if (remaining > 2 && depth < options.depth &&
+                    chance(options.loopIntensity)) {
+                    remaining--;
+                    auto condition = treeCondition();
+                    std::vector<std::unique_ptr<AST::StatementNode>> body;
+                    int n = 1 + pick(4);
+                    for (int i = 0; i < n && remaining > 0; i++)
+                        body.push_back(treeStatement(depth + 1));
+                    return std::make_unique<AST::WhileStatement>(
+                            std::move(condition),
+                            std::make_unique<AST::BlockStatement>(std::move(body)));
+                } else if (remaining > 1 && chance(0.15)) {
+                    remaining--;
+                    auto condition = treeCondition();
+                    auto then = treeSimpleStatement();
+                    if (chance(0.5))
+                        return std::make_unique<AST::IfElseStatement>(
+                                std::move(condition), std::move(then),
+                                treeSimpleStatement());
+                    return std::make_unique<AST::IfStatement>(
+                            std::move(condition), std::move(then));
+                }
+                return treeSimpleStatement();
+            }
+
+        public:
+            explicit ProgramGenerator(GeneratorOptions options)
+                    : options(options)
+                      , rng(options.seed)
+                      , remaining(0)
+                      , nextName(0)
+            {}
+
+            std::string generate()
+            {
+                out.str("");
+                rng.seed(options.seed);
+                options.variables = std::max(options.variables, 1);
+                remaining = options.statements;
+                nextName = 0;
+
+                block(0, 0, options.statements);
+                out << "." << std::endl;
+                return out.str();
+            }
+
+            // The main program as a tree of about `statements` statements.
+            AST::Procedure generateTree()
+            {
+                rng.seed(options.seed);
+                options.variables = std::max(options.variables, 1);
+                remaining = options.statements;
+
+                std::vector<std::unique_ptr<AST::StatementNode>> body;
+                while (remaining > 0)
+                    body.push_back(treeStatement(0));
+                return {"main", std::move(body)};
+            }
+    };
+}
+
+#endif //PL0_COMPILER_GENERATOR_HPP
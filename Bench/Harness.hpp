@@ -0,0 +1,96 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_HARNESS_HPP
+#define PL0_COMPILER_HARNESS_HPP
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <ostream>
+#include <cstdint>
+
+namespace Bench {
+
+    struct Result
+    {
+        std::string name;
+        std::int64_t iterations;
+        double nanosPerOp;
+        std::int64_t itemsPerOp;
+        std::int64_t bytesPerOp;
+    };
+
+    // Keeps the optimiser from discarding values a benchmark computes.
+    template<typename T>
+    inline void keep(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    class Harness
+    {
+            std::vector<Result> results;
+            std::chrono::nanoseconds minTime;
+
+        public:
+            explicit Harness(std::chrono::nanoseconds minTime)
+                    : minTime(minTime)
+            {}
+
+            // Runs `op` in doubling batches until a batch takes at least
+            // minTime, then records the per-operation cost of that batch.
+            void run(std::string name, const std::function<void()> &op,
+                     std::int64_t itemsPerOp = 1, std::int64_t bytesPerOp = 0)
+            {
+                using clock = std::chrono::steady_clock;
+
+                std::int64_t n = 1;
+                std::chrono::nanoseconds elapsed{};
+
+                for (;;) {
+                    auto start = clock::now();
+                    for (std::int64_t i = 0; i < n; i++)
+                        op();
+                    elapsed = clock::now() - start;
+
+                    if (elapsed >= minTime || n >= (std::int64_t{1} << 40))
+                        break;
+                    n *= 2;
+                }
+
+                results.push_back({std::move(name), n,
+                                   static_cast<double>(elapsed.count()) / n,
+                                   itemsPerOp, bytesPerOp});
+            }
+
+            [[nodiscard]] const std::vector<Result> &getResults() const
+            {
+                return results;
+            }
+
+            void writeJson(std::ostream &os) const
+            {
+                os << "{\"benchmarks\": [";
+                for (std::size_t i = 0; i < results.size(); i++) {
+                    const Result &r = results[i];
+                    double seconds = r.nanosPerOp * 1e-9;
+
+                    os << (i ? "," : "") << std::endl;
+                    os << "  {\"name\": \"" << r.name << "\""
+                       << ", \"iterations\": " << r.iterations
+                       << ", \"ns_per_op\": " << r.nanosPerOp
+                       << ", \"items_per_sec\": "
+                       << (seconds > 0 ? r.itemsPerOp / seconds : 0);
+                    if (r.bytesPerOp)
+                        os << ", \"bytes_per_sec\": " << r.bytesPerOp / seconds;
+                    os << "}";
+                }
+                os << std::endl << "]}" << std::endl;
+            }
+    };
+}
+
+#endif //PL0_COMPILER_HARNESS_HPP
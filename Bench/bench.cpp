@@ -0,0 +1,190 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#include "Generator.hpp"
+#include "Harness.hpp"
+#include "../Parser/Location.hpp"
+#include "../Runtime/IO.hpp"
+#include <iostream>
+#include <sstream>
+#include <cstring>
+#include <random>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+static void usage(const char *argv0)
+{
+    std::cerr << "usage: " << argv0 << " [--emit] [--statements N]"
+              << " [--depth N] [--procedures N] [--variables N]"
+              << " [--constant-density P] [--loop-intensity P]"
+              << " [--seed N] [--min-time-ms N]" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    Bench::GeneratorOptions options;
+    bool emit = false;
+    int minTimeMs = 200;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (!std::strcmp(arg, "--emit")) {
+            emit = true;
+            continue;
+        }
+
+        if (!value) {
+            usage(argv[0]);
+            return 2;
+        }
+
+        if (!std::strcmp(arg, "--statements"))
+            options.statements = std::atoi(value);
+        else if (!std::strcmp(arg, "--depth"))
+            options.depth = std::atoi(value);
+        else if (!std::strcmp(arg, "--procedures"))
+            options.procedures = std::atoi(value);
+        else if (!std::strcmp(arg, "--variables"))
+            options.variables = std::atoi(value);
+        else if (!std::strcmp(arg, "--constant-density"))
+            options.constantDensity = std::atof(value);
+        else if (!std::strcmp(arg, "--loop-intensity"))
+            options.loopIntensity = std::atof(value);
+        else if (!std::strcmp(arg, "--seed"))
+            options.seed = static_cast<std::uint32_t>(std::atol(value));
+        else if (!std::strcmp(arg, "--min-time-ms"))
+            minTimeMs = std::atoi(value);
+        else {
+            usage(argv[0]);
+            return 2;
+        }
+        i++;
+    }
+
+    Bench::ProgramGenerator generator(options);
+    std::string program = generator.generate();
+
+    if (emit) {
+        std::cout << program;
+        return 0;
+    }
+
+    std::vector<std::byte> content(program.size());
+    std::memcpy(content.data(), program.data(), program.size());
+    auto bytes = static_cast<std::int64_t>(content.size());
+
+    Parser::SourceFile file("bench.pl0", 0, static_cast<int>(content.size()));
+    file.setLinesForContent(content);
+    std::vector<int> lines = file.getLines();
+    int lineCount = file.getLineCount();
+
+    // Random probes, precomputed so the RNG stays out of the timed loop.
+    std::mt19937 rng(options.seed);
+    std::vector<int> offsets(4096);
+    std::vector<int> lineNumbers(4096);
+    for (auto &o: offsets)
+        o = std::uniform_int_distribution<int>(0, (int) bytes - 1)(rng);
+    for (auto &l: lineNumbers)
+        l = std::uniform_int_distribution<int>(1, lineCount)(rng);
+
+    Bench::Harness harness{std::chrono::milliseconds(minTimeMs)};
+
+    harness.run("generator/generate", [&] {
+        Bench::keep(generator.generate().size());
+    }, options.statements, bytes);
+
+    harness.run("source/setLinesForContent", [&] {
+        file.setLinesForContent(content);
+    }, lineCount, bytes);
+
+    harness.run("source/searchInts", [&] {
+        for (int o: offsets)
+            Bench::keep(Parser::SourceFile::searchInts(lines, o));
+    }, (std::int64_t) offsets.size());
+
+    harness.run("source/lineStart", [&] {
+        for (int l: lineNumbers)
+            Bench::keep(file.lineStart(l));
+    }, (std::int64_t) lineNumbers.size());
+
+    harness.run("source/unpack", [&] {
+        for (int o: offsets)
+            Bench::keep(file.unpack(o, false).line);
+    }, (std::int64_t) offsets.size());
+
+    // AST construction and printing, per statement. There is no parser
+    // yet, so the tree comes straight from the generator and ast/construct
+    // includes the generator's own random choices.
+    AST::Procedure tree = generator.generateTree();
+    std::string text = tree.toString();
+    std::ostringstream json;
+    tree.dump(json);
+
+    harness.run("ast/construct", [&] {
+        Bench::keep(generator.generateTree().getStatements().size());
+    }, options.statements);
+
+    harness.run("ast/toString", [&] {
+        Bench::keep(tree.toString().size());
+    }, options.statements, (std::int64_t) text.size());
+
+    harness.run("ast/dump", [&] {
+        std::ostringstream os;
+        tree.dump(os);
+        Bench::keep(os.tellp());
+    }, options.statements, (std::int64_t) json.tellp());
+
+    // READ/WRITE throughput, in values per second.
+    const int ioValues = 1 << 16;
+    int devNull = open("/dev/null", O_WRONLY);
+    if (devNull < 0) {
+        std::perror("/dev/null");
+        return 1;
+    }
+    Runtime::OutputBuffer sink(devNull);
+
+    harness.run("runtime/write", [&] {
+        for (int i = 0; i < ioValues; i++)
+            sink.writeInt(i * 7919 - 1000000);
+        sink.flush();
+    }, ioValues);
+
+    char inputPath[] = "/tmp/pl0_bench_XXXXXX";
+    int inputFd = mkstemp(inputPath);
+    if (inputFd < 0) {
+        std::perror(inputPath);
+        close(devNull);
+        return 1;
+    }
+    {
+        Runtime::OutputBuffer input(inputFd);
+        for (int i = 0; i < ioValues; i++)
+            input.writeInt(i * 7919 - 1000000);
+    }
+
+    harness.run("runtime/read", [&] {
+        lseek(inputFd, 0, SEEK_SET);
+        Runtime::InputBuffer source(inputFd);
+        int value;
+        while (source.readInt(value))
+            Bench::keep(value);
+    }, ioValues);
+
+    close(inputFd);
+    std::remove(inputPath);
+    close(devNull);
+
+    std::cout << "{\"program\": {\"statements\": " << options.statements
+              << ", \"depth\": " << options.depth
+              << ", \"bytes\": " << bytes
+              << ", \"lines\": " << lineCount << "}," << std::endl;
+    std::cout << "\"results\": ";
+    harness.writeJson(std::cout);
+    std::cout << "}" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_DIAGNOSTICS_HPP
+#define PL0_COMPILER_DIAGNOSTICS_HPP
+
+#include "Location.hpp"
+#include <string>
+#include <vector>
+#include <ostream>
+#include <algorithm>
+
+namespace Parser {
+
+    enum class Severity
+    {
+        WARNING,
+        ERROR,
+    };
+
+    struct Diagnostic
+    {
+        int offset;
+        Severity severity;
+        std::string message;
+    };
+
+    // Buffers diagnostics against raw source offsets. Nothing is resolved
+    // to file:line:column until flush(), so reporting stays cheap however
+    // many diagnostics a compile produces.
+    class Diagnostics
+    {
+            std::vector<Diagnostic> pending;
+            int errors = 0;
+            int warnings = 0;
+
+        public:
+            void report(Severity severity, int offset, std::string message)
+            {
+                if (severity == Severity::ERROR)
+                    errors++;
+                else
+                    warnings++;
+
+                pending.push_back({offset, severity, std::move(message)});
+            }
+
+            void error(int offset, std::string message)
+            {
+                report(Severity::ERROR, offset, std::move(message));
+            }
+
+            void warning(int offset, std::string message)
+            {
+                report(Severity::WARNING, offset, std::move(message));
+            }
+
+            [[nodiscard]] int getErrorCount() const
+            {
+                return errors;
+            }
+
+            [[nodiscard]] int getWarningCount() const
+            {
+                return warnings;
+            }
+
+            [[nodiscard]] bool hasErrors() const
+            {
+                return errors > 0;
+            }
+
+            // Writes the pending diagnostics in source order, resolving each
+            // offset against `file`, and clears the buffer. Diagnostics at
+            // the same offset keep the order they were reported in. Those at
+            // NO_POSITION come first and give only the file name.
+            void flush(std::ostream &os, SourceFile &file)
+            {
+                std::stable_sort(pending.begin(), pending.end(),
+                                 [](const Diagnostic &lhs,
+                                    const Diagnostic &rhs) {
+                                     return lhs.offset < rhs.offset;
+                                 });
+
+                for (const Diagnostic &d: pending) {
+                    if (d.offset == NO_POSITION) {
+                        os << file.getName();
+                    } else {
+                        LineInfo info = file.unpack(d.offset, true);
+                        os << info.filename << ':' << info.line << ':'
+                           << info.column;
+                    }
+
+                    os << (d.severity == Severity::ERROR ? ": error: "
+                                                         : ": warning: ")
+                       << d.message << '\n';
+                }
+
+                pending.clear();
+            }
+    };
+}
+
+#endif //PL0_COMPILER_DIAGNOSTICS_HPP
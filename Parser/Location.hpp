@@ -12,10 +12,13 @@
 #include <stdexcept>
 #include <cstdint>
 #include <algorithm>
+#include <cstring>
 
 namespace Parser {
 
-    const int NO_POSITION = 0;
+    // Position of a node or diagnostic with no place in the source. Offset 0
+    // is the first byte of the first file, so it cannot serve.
+    const int NO_POSITION = -1;
 
     struct LineInfo
     {
@@ -43,6 +46,12 @@ namespace Parser {
             std::vector<LineInfo> infos;
 
         public:
+            SourceFile(std::string name, int base, int size)
+                    : name(std::move(name))
+                      , base(base)
+                      , size(size)
+            {}
+
             [[nodiscard]] std::string getName() const
             {
                 return name;
@@ -132,23 +141,33 @@ namespace Parser {
 
             void setLinesForContent(const std::vector<std::byte> &content)
             {
+                const char *data = reinterpret_cast<const char *>(content.data());
+                const char *end = data + content.size();
+
                 std::vector<int> l;
-                int line = 0;
-                for (std::size_t offset = 0;
-                     offset < content.size(); ++offset) {
-                    std::byte b = content[offset];
-                    if (line >= 0) {
-                        l.push_back(line);
-                    }
-                    line = -1;
-                    if (b == static_cast<std::byte>('\n')) {
-                        line = static_cast<int>(offset) + 1;
-                    }
+                if (data == end) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    this->lines.clear();
+                    return;
+                }
+
+                // Counting first sizes the table exactly; both passes are
+                // vectorised scans over the buffer.
+                l.reserve(1 + std::count(data, end, '\n'));
+                l.push_back(0);
+
+                const char *p = data;
+                while ((p = static_cast<const char *>(
+                        std::memchr(p, '\n', end - p))) != nullptr) {
+                    // A trailing newline does not start a new line.
+                    if (++p == end)
+                        break;
+                    l.push_back(static_cast<int>(p - data));
                 }
 
                 {
                     std::lock_guard<std::mutex> lock(mutex);
-                    this->lines = l;
+                    this->lines = std::move(l);
                 }
             }
 
@@ -204,32 +223,28 @@ namespace Parser {
                 return i - 1;
             }
 
-            int searchLineInfos(const std::vector<LineInfo> &a, int x)
+            // infos is kept sorted by addLineColumnInfo, which only accepts
+            // increasing offsets, so a binary search is all that is needed.
+            static int searchLineInfos(const std::vector<LineInfo> &a, int x)
             {
-                // FIXME: we shouldn't be sorting this every time we want to search
-                std::sort(infos.begin(), infos.end(),
-                          [](const LineInfo &lhs, const LineInfo &rhs) {
-                              return lhs.offset < rhs.offset;
-                          });
-
-                auto it = std::lower_bound(infos.begin(), infos.end(), x,
-                                           [](const LineInfo &info, int value) {
-                                               return info.offset < value;
+                auto it = std::upper_bound(a.begin(), a.end(), x,
+                                           [](int value, const LineInfo &info) {
+                                               return value < info.offset;
                                            });
 
-                return static_cast<int>(std::distance(infos.begin(), it)) - 1;
+                return static_cast<int>(std::distance(a.begin(), it)) - 1;
             }
 
             LineInfo unpack(int offset, bool adjusted)
             {
-                int line;
-                int column;
+                int line = 0;
+                int column = 0;
                 std::string filename;
 
                 {
                     std::lock_guard<std::mutex> lock(mutex);
 
-                    filename = std::move(name);
+                    filename = name;
                     int i = searchInts(lines, offset);
 
                     if (i >= 0) {
@@ -238,24 +253,28 @@ namespace Parser {
                     }
 
                     if (adjusted && !infos.empty()) {
-                        LineInfo alt = infos[i];
-                        filename = std::move(alt.filename);
                         i = searchLineInfos(infos, offset);
 
                         if (i >= 0) {
-                            int d = line - (i + 1);
-                            line = alt.line + d;
-
-                            if (!alt.column) { // alt.column == 0
-                                column = 0;
-                            } else if (!d) { // d == 0
-                                column = alt.column + (offset - alt.offset);
+                            const LineInfo &alt = infos[i];
+                            filename = alt.filename;
+                            i = searchInts(lines, alt.offset);
+
+                            if (i >= 0) {
+                                int d = line - (i + 1);
+                                line = alt.line + d;
+
+                                if (!alt.column) { // alt.column == 0
+                                    column = 0;
+                                } else if (!d) { // d == 0
+                                    column = alt.column + (offset - alt.offset);
+                                }
                             }
                         }
                     }
                 }
 
-                return {offset, filename, line, column};
+                return {offset, std::move(filename), line, column};
             }
     };
 }
@@ -0,0 +1,357 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_IO_HPP
+#define PL0_COMPILER_IO_HPP
+
+#include <vector>
+#include <string>
+#include <charconv>
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#include <limits>
+#include <algorithm>
+#include <unistd.h>
+#include <poll.h>
+
+namespace Runtime {
+
+    enum class ReadStatus
+    {
+        VALUE,       // a value was read
+        END,         // end of input
+        WOULD_BLOCK, // no complete value is available yet
+    };
+
+    enum class FlushPolicy
+    {
+        WHEN_FULL,  // flush only when the buffer fills, or on flush()/exit
+        EACH_WRITE, // flush after every WRITE unless inside a batch
+    };
+
+    // Buffered integer output for WRITE, one value per line, on a raw file
+    // descriptor. Formatting goes straight into the buffer with
+    // std::to_chars; nothing is allocated after construction.
+    class OutputBuffer
+    {
+            // Sign, digits and the trailing newline.
+            static constexpr std::size_t MAX_VALUE_CHARS =
+                    std::numeric_limits<int>::digits10 + 3;
+
+            int fd;
+            FlushPolicy policy;
+            std::vector<char> buffer;
+            std::size_t used;
+            int batchDepth;
+
+            void put(int value)
+            {
+                char *first = buffer.data() + used;
+                auto result = std::to_chars(first, buffer.data() + buffer.size(),
+                                            value);
+                *result.ptr++ = '\n';
+                used = result.ptr - buffer.data();
+            }
+
+        public:
+            explicit OutputBuffer(int fd,
+                                  FlushPolicy policy = FlushPolicy::WHEN_FULL,
+                                  std::size_t capacity = 1 << 16)
+                    : fd(fd)
+                      , policy(policy)
+                      , buffer(std::max(capacity, MAX_VALUE_CHARS))
+                      , used(0)
+                      , batchDepth(0)
+            {}
+
+            OutputBuffer(const OutputBuffer &) = delete;
+            OutputBuffer &operator=(const OutputBuffer &) = delete;
+
+            ~OutputBuffer()
+            {
+                try {
+                    flush();
+                } catch (const std::runtime_error &) {
+                    // Nothing sensible to do with a failed write at exit.
+                }
+            }
+
+            // Writes out anything pending and retargets the buffer at `fd`,
+            // keeping its storage, so a pooled VM context can be reused for
+            // the next run without reallocating.
+            void reset(int newFd)
+            {
+                flush();
+                fd = newFd;
+                batchDepth = 0;
+            }
+
+            void writeInt(int value)
+            {
+                if (buffer.size() - used < MAX_VALUE_CHARS)
+                    flush();
+
+                put(value);
+
+                if (policy == FlushPolicy::EACH_WRITE && !batchDepth)
+                    flush();
+            }
+
+            // Non-blocking WRITE for a descriptor opened with O_NONBLOCK.
+            // Returns false, without consuming the value, when the buffer is
+            // full and the descriptor cannot take more; the caller should
+            // wait for it to become writable and try again.
+            bool tryWriteInt(int value)
+            {
+                if (buffer.size() - used < MAX_VALUE_CHARS) {
+                    tryFlush();
+                    if (buffer.size() - used < MAX_VALUE_CHARS)
+                        return false;
+                }
+
+                put(value);
+
+                if (policy == FlushPolicy::EACH_WRITE && !batchDepth)
+                    tryFlush();
+                return true;
+            }
+
+            // Suppresses per-WRITE flushing until the matching endBatch(),
+            // e.g. for the duration of a WHILE loop. Batches nest.
+            void beginBatch()
+            {
+                batchDepth++;
+            }
+
+            // An endBatch() without a matching beginBatch(), e.g. one left
+            // over from before reset(), is ignored.
+            void endBatch()
+            {
+                if (batchDepth == 0)
+                    return;
+                if (--batchDepth == 0 && policy == FlushPolicy::EACH_WRITE)
+                    flush();
+            }
+
+            // Writes out everything pending, waiting for the descriptor to
+            // become writable if it is non-blocking and full.
+            void flush()
+            {
+                std::size_t done = 0;
+
+                while (done < used) {
+                    ssize_t n = ::write(fd, buffer.data() + done, used - done);
+                    if (n < 0) {
+                        if (errno == EINTR)
+                            continue;
+                        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                            pollfd p{fd, POLLOUT, 0};
+                            if (::poll(&p, 1, -1) >= 0 || errno == EINTR)
+                                continue;
+                        }
+                        used = 0;
+                        throw std::runtime_error(
+                                std::string("write failed: ") +
+                                std::strerror(errno));
+                    }
+                    done += static_cast<std::size_t>(n);
+                }
+
+                used = 0;
+            }
+
+            // Writes as much as the descriptor accepts without blocking and
+            // keeps the rest. Returns true once nothing is pending.
+            bool tryFlush()
+            {
+                std::size_t done = 0;
+
+                while (done < used) {
+                    ssize_t n = ::write(fd, buffer.data() + done, used - done);
+                    if (n < 0) {
+                        if (errno == EINTR)
+                            continue;
+                        if (errno == EAGAIN || errno == EWOULDBLOCK)
+                            break;
+                        used = 0;
+                        throw std::runtime_error(
+                                std::string("write failed: ") +
+                                std::strerror(errno));
+                    }
+                    done += static_cast<std::size_t>(n);
+                }
+
+                std::memmove(buffer.data(), buffer.data() + done, used - done);
+                used -= done;
+                return used == 0;
+            }
+    };
+
+    // Buffered integer input for READ on a raw file descriptor. Values are
+    // separated by whitespace and parsed in place with std::from_chars.
+    class InputBuffer
+    {
+            // Longest token that could still be an int: a sign, the digits
+            // and a generous run of leading zeros. A longer one is rejected
+            // as soon as it is seen rather than buffered in full.
+            static constexpr std::size_t MAX_TOKEN_CHARS = 64;
+
+            int fd;
+            std::vector<char> buffer;
+            std::size_t start;
+            std::size_t end;
+            bool eof;
+            OutputBuffer *tie;
+
+            static bool isSpace(char c)
+            {
+                return c == ' ' || c == '\n' || c == '\t' || c == '\r' ||
+                       c == '\v' || c == '\f';
+            }
+
+            // Keeps the unread bytes, moving them to the front, and reads
+            // more after them. Only a non-blocking refill reports
+            // WOULD_BLOCK; otherwise EAGAIN is an error like any other.
+            ReadStatus refill(bool blocking)
+            {
+                if (eof)
+                    return ReadStatus::END;
+
+                if (tie) {
+                    if (blocking)
+                        tie->flush();
+                    else
+                        tie->tryFlush();
+                }
+
+                // next() never leaves more than MAX_TOKEN_CHARS pending, so
+                // there is always room to read into.
+                std::memmove(buffer.data(), buffer.data() + start, end - start);
+                end -= start;
+                start = 0;
+
+                ssize_t n;
+                do {
+                    n = ::read(fd, buffer.data() + end, buffer.size() - end);
+                } while (n < 0 && errno == EINTR);
+
+                if (n < 0) {
+                    if (!blocking && (errno == EAGAIN || errno == EWOULDBLOCK))
+                        return ReadStatus::WOULD_BLOCK;
+                    throw std::runtime_error(std::string("read failed: ") +
+                                             std::strerror(errno));
+                }
+
+                if (n == 0) {
+                    eof = true;
+                    return ReadStatus::END;
+                }
+
+                end += static_cast<std::size_t>(n);
+                return ReadStatus::VALUE;
+            }
+
+            [[noreturn]] void invalid(std::size_t length)
+            {
+                const std::size_t shown = 32;
+                throw std::invalid_argument(
+                        "invalid integer input: " +
+                        std::string(buffer.data() + start,
+                                    std::min(length, shown)) +
+                        (length > shown ? "..." : ""));
+            }
+
+            ReadStatus next(int &value, bool blocking)
+            {
+                for (;;) {
+                    while (start < end && isSpace(buffer[start]))
+                        start++;
+                    if (start < end)
+                        break;
+
+                    ReadStatus status = refill(blocking);
+                    if (status != ReadStatus::VALUE)
+                        return status;
+                }
+
+                // A value only counts once the whitespace (or end of input)
+                // after it has been seen; until then it may continue.
+                std::size_t i = start;
+                for (;;) {
+                    while (i < end && !isSpace(buffer[i]))
+                        i++;
+                    if (i < end)
+                        break;
+
+                    // refill() moves the pending bytes to the front.
+                    std::size_t length = i - start;
+                    if (length > MAX_TOKEN_CHARS)
+                        invalid(length);
+                    ReadStatus status = refill(blocking);
+                    i = start + length;
+                    if (status == ReadStatus::WOULD_BLOCK)
+                        return status;
+                    if (status == ReadStatus::END)
+                        break;
+                }
+
+                const char *first = buffer.data() + start;
+                const char *last = buffer.data() + i;
+                if (*first == '+' && last - first > 1 && first[1] != '-')
+                    first++;
+
+                auto result = std::from_chars(first, last, value);
+                if (result.ec != std::errc() || result.ptr != last)
+                    invalid(i - start);
+
+                start = i;
+                return ReadStatus::VALUE;
+            }
+
+        public:
+            // `tie`, if given, is flushed before blocking for input so that
+            // prompts written by the program appear first.
+            explicit InputBuffer(int fd, OutputBuffer *tie = nullptr,
+                                 std::size_t capacity = 1 << 16)
+                    : fd(fd)
+                      , buffer(std::max(capacity, 2 * MAX_TOKEN_CHARS))
+                      , start(0)
+                      , end(0)
+                      , eof(false)
+                      , tie(tie)
+            {}
+
+            InputBuffer(const InputBuffer &) = delete;
+            InputBuffer &operator=(const InputBuffer &) = delete;
+
+            // Discards any unread input and starts reading `newFd`, keeping
+            // the buffer's storage.
+            void reset(int newFd, OutputBuffer *newTie = nullptr)
+            {
+                fd = newFd;
+                start = 0;
+                end = 0;
+                eof = false;
+                tie = newTie;
+            }
+
+            // Reads the next integer. Returns false at end of input; throws
+            // std::invalid_argument if the next token is not an int.
+            bool readInt(int &value)
+            {
+                return next(value, true) == ReadStatus::VALUE;
+            }
+
+            // Non-blocking READ for a descriptor opened with O_NONBLOCK.
+            // WOULD_BLOCK leaves the input position unchanged; the caller
+            // should wait for the descriptor to become readable and retry.
+            ReadStatus tryReadInt(int &value)
+            {
+                return next(value, false);
+            }
+    };
+}
+
+#endif //PL0_COMPILER_IO_HPP
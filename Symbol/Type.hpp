@@ -5,12 +5,24 @@
 #ifndef PL0_COMPILER_TYPE_HPP
 #define PL0_COMPILER_TYPE_HPP
 
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
+#include <limits>
+
 namespace Symbol {
 
     class Type
     {
         public:
             virtual ~Type() = default;
+
+            // Number of variable slots a value of this type occupies, as
+            // passed to Scope::allocVariableSpace.
+            [[nodiscard]] virtual int getSize() const
+            {
+                return 1;
+            }
     };
 
     class ScalarType : public Type
@@ -21,14 +33,100 @@ namespace Symbol {
 
     class SubrangeType : public ScalarType
     {
+            int lower;
+            int upper;
+
         public:
+            SubrangeType(int lower, int upper)
+                    : lower(lower)
+                      , upper(upper)
+            {
+                if (lower > upper)
+                    throw std::invalid_argument("empty subrange");
+            }
+
             ~SubrangeType() override = default;
+
+            [[nodiscard]] int getLower() const
+            {
+                return lower;
+            }
+
+            [[nodiscard]] int getUpper() const
+            {
+                return upper;
+            }
+
+            [[nodiscard]] bool contains(int value) const
+            {
+                return lower <= value && value <= upper;
+            }
+
+            // True when every value in [low, high] lies in the subrange. A
+            // range analysis that proves this for an index expression lets
+            // the bounds check on that access be dropped.
+            [[nodiscard]] bool contains(int low, int high) const
+            {
+                return lower <= low && high <= upper;
+            }
+
+            // Number of values in the subrange. A full-width subrange has
+            // more values than an int can hold.
+            [[nodiscard]] std::int64_t getCount() const
+            {
+                return std::int64_t(upper) - lower + 1;
+            }
     };
 
+    // An array: `element` repeated once for each value of `index`. Throws
+    // std::invalid_argument without an element type, and std::length_error
+    // if the array needs more slots than a frame can address.
     class ProductType : public Type
     {
+            SubrangeType index;
+            std::unique_ptr<Type> element;
+            int size;
+
         public:
+            ProductType(SubrangeType index, std::unique_ptr<Type> element)
+                    : index(index)
+                      , element(std::move(element))
+            {
+                if (!this->element)
+                    throw std::invalid_argument("array without element type");
+
+                std::int64_t count = this->index.getCount();
+                std::int64_t elementSize = this->element->getSize();
+                if (elementSize &&
+                    count > std::numeric_limits<int>::max() / elementSize)
+                    throw std::length_error("array too large for a frame");
+                size = static_cast<int>(count * elementSize);
+            }
+
             ~ProductType() override = default;
+
+            [[nodiscard]] const SubrangeType &getIndexType() const
+            {
+                return index;
+            }
+
+            [[nodiscard]] const Type &getElementType() const
+            {
+                return *element;
+            }
+
+            [[nodiscard]] int getSize() const override
+            {
+                return size;
+            }
+
+            // Slot offset of element `i` from the start of the array. The
+            // caller is responsible for the bounds check, if one is needed.
+            [[nodiscard]] int offsetOf(int i) const
+            {
+                return static_cast<int>((std::int64_t(i) - index.getLower()) *
+                                        element->getSize());
+            }
     };
 }
 #endif //PL0_COMPILER_TYPE_HPP
@@ -0,0 +1,53 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_BUILDERS_HPP
+#define PL0_COMPILER_BUILDERS_HPP
+
+#include "../AST/ExpressionNode.hpp"
+#include "../AST/StatementNode.hpp"
+#include "../AST/ProcedureNode.hpp"
+#include <memory>
+#include <utility>
+
+// Shorthands for building small ASTs by hand in tests.
+namespace Tests {
+
+    template<typename T, typename... Args>
+    std::unique_ptr<T> at(int position, Args &&... args)
+    {
+        auto node = std::make_unique<T>(std::forward<Args>(args)...);
+        node->setPosition(position);
+        return node;
+    }
+
+    inline std::unique_ptr<AST::ExpressionNode> var(const char *name,
+                                                    int position = Parser::NO_POSITION)
+    {
+        return at<AST::VariableExpression>(position, name);
+    }
+
+    inline std::unique_ptr<AST::ExpressionNode> num(int value)
+    {
+        return std::make_unique<AST::ConstantExpression>(value);
+    }
+
+    inline std::unique_ptr<AST::StatementNode> call(const char *name)
+    {
+        return std::make_unique<AST::CallStatement>(
+                std::make_unique<AST::Procedure>(
+                        name, std::vector<std::unique_ptr<AST::StatementNode>>()));
+    }
+
+    template<typename... Statements>
+    std::vector<std::unique_ptr<AST::StatementNode>>
+    statements(Statements &&... s)
+    {
+        std::vector<std::unique_ptr<AST::StatementNode>> result;
+        (result.push_back(std::forward<Statements>(s)), ...);
+        return result;
+    }
+}
+
+#endif //PL0_COMPILER_BUILDERS_HPP
@@ -0,0 +1,99 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#include "Check.hpp"
+#include "Builders.hpp"
+#include "../Analysis/CallGraph.hpp"
+#include <algorithm>
+
+using namespace AST;
+using namespace Tests;
+
+namespace {
+
+    int indexOf(const std::vector<const Procedure *> &order,
+                const Procedure &procedure)
+    {
+        auto it = std::find(order.begin(), order.end(), &procedure);
+        return it == order.end() ? -1 : static_cast<int>(it - order.begin());
+    }
+
+    // main calls a and b; b calls itself; a calls c, and c and d call each
+    // other. Nothing calls e.
+    void componentsAndReachability()
+    {
+        Procedure main("main", statements(call("a"), call("b")));
+        Procedure a("a", statements(call("c")));
+        Procedure b("b", statements(call("b")));
+        Procedure c("c", statements(call("d")));
+        Procedure d("d", statements(call("c")));
+        Procedure e("e", statements(call("a")));
+
+        Analysis::CallGraph graph({&main, &a, &b, &c, &d, &e});
+
+        for (int i = 0; i < 5; i++)
+            CHECK(graph.isReachable(i));
+        CHECK(!graph.isReachable(5));
+        auto unreachable = graph.getUnreachable();
+        CHECK(unreachable.size() == 1 && unreachable[0] == &e);
+
+        CHECK(!graph.isRecursive(0));
+        CHECK(!graph.isRecursive(1));
+        CHECK(graph.isRecursive(2));
+        CHECK(graph.isRecursive(3));
+        CHECK(graph.isRecursive(4));
+
+        auto order = graph.bottomUpOrder();
+        CHECK(order.size() == 5);
+        CHECK(indexOf(order, e) < 0);
+        CHECK(indexOf(order, c) < indexOf(order, a));
+        CHECK(indexOf(order, d) < indexOf(order, a));
+        CHECK(indexOf(order, a) < indexOf(order, main));
+        CHECK(indexOf(order, b) < indexOf(order, main));
+    }
+
+    // Two nested blocks both declare q, and only the second calls r.
+    Procedure q1("q", statements());
+    Procedure q2("q", statements(call("r")));
+    Procedure r("r", statements());
+
+    // By name alone the call to q may reach either, so neither q nor r
+    // may be dropped.
+    void duplicateNamesStayReachable()
+    {
+        Procedure main("main", statements(call("q")));
+        Analysis::CallGraph graph({&main, &q1, &q2, &r});
+
+        CHECK(graph.getCallees(0).size() == 2);
+        CHECK(graph.getUnreachable().empty());
+    }
+
+    // A resolver that knows the call binds to the first q lets the second
+    // one, and r, be dropped.
+    void resolverPicksTarget()
+    {
+        Procedure main("main", statements(call("q")));
+        const StatementNode *site = main.getStatements()[0].get();
+
+        Analysis::CallGraph graph(
+                {&main, &q1, &q2, &r},
+                [site](const CallStatement &call) {
+                    return &call == site ? 1 : -1;
+                });
+
+        CHECK(graph.getCallees(0) == std::vector<int>{1});
+        auto unreachable = graph.getUnreachable();
+        CHECK(unreachable.size() == 2);
+        CHECK(indexOf(unreachable, q2) >= 0);
+        CHECK(indexOf(unreachable, r) >= 0);
+    }
+}
+
+int main()
+{
+    componentsAndReachability();
+    duplicateNamesStayReachable();
+    resolverPicksTarget();
+    return Tests::result();
+}
@@ -0,0 +1,35 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#ifndef PL0_COMPILER_CHECK_HPP
+#define PL0_COMPILER_CHECK_HPP
+
+#include <iostream>
+
+namespace Tests {
+
+    inline int failures = 0;
+
+    inline void check(bool condition, const char *expression, const char *file,
+                      int line)
+    {
+        if (!condition) {
+            std::cerr << file << ":" << line << ": check failed: "
+                      << expression << std::endl;
+            failures++;
+        }
+    }
+
+    // Exit status for main(): non-zero if any check failed.
+    inline int result()
+    {
+        if (failures)
+            std::cerr << failures << " check(s) failed" << std::endl;
+        return failures ? 1 : 0;
+    }
+}
+
+#define CHECK(condition) Tests::check((condition), #condition, __FILE__, __LINE__)
+
+#endif //PL0_COMPILER_CHECK_HPP
@@ -0,0 +1,81 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#include "Check.hpp"
+#include "Builders.hpp"
+#include "../Analysis/Dataflow.hpp"
+
+using namespace AST;
+
+using Tests::at;
+using Tests::var;
+using Tests::num;
+
+namespace {
+
+    enum Variable
+    {
+        X, Y, Z, W
+    };
+
+    // x := 1;                              (1)
+    // y := 5;                              (2)
+    // WHILE x < 10 DO                      (3)
+    //     BEGIN x := x + 1; y := x END;    (4, 5)
+    // WRITE y;                             (6)
+    // z := y;                              (7)  dead store
+    // IF x THEN w := 1;                    (8, 9)
+    // WRITE w                              (10) w may be unassigned
+    Procedure program()
+    {
+        std::vector<std::unique_ptr<StatementNode>> body;
+        body.push_back(at<AssignmentStatement>(4, "x",
+                std::make_unique<BinaryExpression>(var("x", 40), num(1), "+")));
+        body.push_back(at<AssignmentStatement>(5, "y", var("x", 50)));
+
+        std::vector<std::unique_ptr<StatementNode>> s;
+        s.push_back(at<AssignmentStatement>(1, "x", num(1)));
+        s.push_back(at<AssignmentStatement>(2, "y", num(5)));
+        s.push_back(at<WhileStatement>(3,
+                std::make_unique<BinaryExpression>(var("x", 30), num(10), "<"),
+                std::make_unique<BlockStatement>(std::move(body))));
+        s.push_back(at<WriteStatement>(6, var("y", 60)));
+        s.push_back(at<AssignmentStatement>(7, "z", var("y", 70)));
+        s.push_back(at<IfStatement>(8, var("x", 80),
+                                    at<AssignmentStatement>(9, "w", num(1))));
+        s.push_back(at<WriteStatement>(10, var("w", 100)));
+        return {"main", std::move(s)};
+    }
+}
+
+int main()
+{
+    Procedure p = program();
+    Analysis::ControlFlowGraph cfg =
+            Analysis::ControlFlowGraphBuilder({"x", "y", "z", "w"}).build(p);
+
+    // Only w can reach a use without an assignment on the way.
+    Analysis::Solution live = Analysis::liveness(cfg);
+    Analysis::BitVector entry = live.in[cfg.getEntry()];
+    CHECK(entry.count() == 1);
+    CHECK(entry.test(W));
+    CHECK(live.out[cfg.getExit()].count() == 0);
+
+    auto unassigned = Analysis::findUnassignedUses(cfg);
+    CHECK(unassigned.size() == 1);
+    if (!unassigned.empty()) {
+        CHECK(unassigned[0].symbol == W);
+        CHECK(unassigned[0].position == 100);
+    }
+
+    // y := 5 is not dead: the loop may run zero times.
+    auto dead = Analysis::findDeadStores(cfg);
+    CHECK(dead.size() == 1);
+    if (!dead.empty()) {
+        CHECK(dead[0].symbol == Z);
+        CHECK(dead[0].position == 7);
+    }
+
+    return Tests::result();
+}
@@ -0,0 +1,100 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#include "Check.hpp"
+#include "Builders.hpp"
+#include "../Analysis/FrameLayout.hpp"
+
+using namespace AST;
+using namespace Tests;
+
+namespace {
+
+    Analysis::FrameLayout layout(std::vector<std::string> variables,
+                                 std::vector<std::unique_ptr<StatementNode>> body)
+    {
+        Procedure p("main", std::move(body));
+        return Analysis::layoutFrame(
+                Analysis::ControlFlowGraphBuilder(variables).build(p));
+    }
+
+    // a := 1; WRITE a; b := 2; WRITE b; c := 3; d := c; WRITE c + d
+    // a, b and c never overlap; only c and d are live together.
+    void sharesDisjointRanges()
+    {
+        auto frame = layout(
+                {"a", "b", "c", "d"},
+                statements(
+                        std::make_unique<AssignmentStatement>("a", num(1)),
+                        std::make_unique<WriteStatement>(var("a")),
+                        std::make_unique<AssignmentStatement>("b", num(2)),
+                        std::make_unique<WriteStatement>(var("b")),
+                        std::make_unique<AssignmentStatement>("c", num(3)),
+                        std::make_unique<AssignmentStatement>("d", var("c")),
+                        std::make_unique<WriteStatement>(
+                                std::make_unique<BinaryExpression>(
+                                        var("c"), var("d"), "+"))));
+
+        CHECK(frame.getUnpackedSize() == 4);
+        CHECK(frame.getFrameSize() == 2);
+        CHECK(frame.getSlot(0) == frame.getSlot(1));
+        CHECK(frame.getSlot(1) == frame.getSlot(2));
+        CHECK(frame.getSlot(2) != frame.getSlot(3));
+    }
+
+    // a := 1; CALL p; WRITE a; b := 2; WRITE b
+    // Without the call a and b could share; a nested p may write any slot,
+    // so a, live across the call, must keep its own.
+    void keepsSlotsLiveAcrossCall()
+    {
+        auto frame = layout(
+                {"a", "b"},
+                statements(
+                        std::make_unique<AssignmentStatement>("a", num(1)),
+                        call("p"),
+                        std::make_unique<WriteStatement>(var("a")),
+                        std::make_unique<AssignmentStatement>("b", num(2)),
+                        std::make_unique<WriteStatement>(var("b"))));
+
+        CHECK(frame.getUnpackedSize() == 2);
+        CHECK(frame.getFrameSize() == 2);
+        CHECK(frame.getSlot(0) != frame.getSlot(1));
+    }
+
+    // CALL p; WRITE a; WRITE b
+    // Neither variable is assigned here, so only the call can have given
+    // them values: a nested p writes each to its own slot.
+    void keepsSlotsAssignedByCall()
+    {
+        auto frame = layout(
+                {"a", "b"},
+                statements(call("p"),
+                           std::make_unique<WriteStatement>(var("a")),
+                           std::make_unique<WriteStatement>(var("b"))));
+
+        CHECK(frame.getFrameSize() == 2);
+        CHECK(frame.getSlot(0) != frame.getSlot(1));
+    }
+
+    // VAR x, y; PROCEDURE run; BEGIN x := 1; y := 2; WRITE x END;
+    // BEGIN CALL run END.
+    // Nothing in main is live around the call, but run uses x and y at
+    // the same time, so they must not share a slot.
+    void keepsSlotsUsedTogetherByCallee()
+    {
+        auto frame = layout({"x", "y"}, statements(call("run")));
+
+        CHECK(frame.getFrameSize() == 2);
+        CHECK(frame.getSlot(0) != frame.getSlot(1));
+    }
+}
+
+int main()
+{
+    sharesDisjointRanges();
+    keepsSlotsLiveAcrossCall();
+    keepsSlotsAssignedByCall();
+    keepsSlotsUsedTogetherByCallee();
+    return Tests::result();
+}
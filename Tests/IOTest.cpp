@@ -0,0 +1,196 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#include "Check.hpp"
+#include "../Runtime/IO.hpp"
+#include <climits>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <fcntl.h>
+
+using Runtime::InputBuffer;
+using Runtime::OutputBuffer;
+
+namespace {
+
+    // A pipe whose read end holds `text`, followed by end of input.
+    int pipeWith(const std::string &text)
+    {
+        int fds[2];
+        if (pipe(fds) < 0)
+            return -1;
+        ssize_t n = ::write(fds[1], text.data(), text.size());
+        close(fds[1]);
+        return n == static_cast<ssize_t>(text.size()) ? fds[0] : -1;
+    }
+
+    bool throwsInvalid(const std::string &text)
+    {
+        int fd = pipeWith(text);
+        InputBuffer in(fd);
+        int value;
+        bool threw = false;
+        try {
+            in.readInt(value);
+        } catch (const std::invalid_argument &) {
+            threw = true;
+        }
+        close(fd);
+        return threw;
+    }
+
+    // The smallest buffer holds 128 bytes, so the value starting at offset
+    // 126 is only complete after a second read.
+    void valueSplitAcrossRefill()
+    {
+        int fd = pipeWith(std::string(126, ' ') + "12345 6");
+        InputBuffer in(fd, nullptr, 1);
+        int value = 0;
+        CHECK(in.readInt(value) && value == 12345);
+        CHECK(in.readInt(value) && value == 6);
+        CHECK(!in.readInt(value));
+        close(fd);
+    }
+
+    void signs()
+    {
+        int fd = pipeWith("+7 -8\n");
+        InputBuffer in(fd);
+        int value = 0;
+        CHECK(in.readInt(value) && value == 7);
+        CHECK(in.readInt(value) && value == -8);
+        close(fd);
+
+        CHECK(throwsInvalid("+ 1"));
+        CHECK(throwsInvalid("12x"));
+        CHECK(throwsInvalid("+-1"));
+        CHECK(throwsInvalid("2147483648"));
+    }
+
+    // Leading zeros are fine up to the token limit; a longer run of digits
+    // is rejected without being buffered whole, and the message is cut.
+    void longTokens()
+    {
+        int fd = pipeWith(std::string(40, '0') + "42 ");
+        InputBuffer in(fd);
+        int value = 0;
+        CHECK(in.readInt(value) && value == 42);
+        close(fd);
+
+        fd = pipeWith(std::string(4096, '1'));
+        InputBuffer tooLong(fd);
+        try {
+            tooLong.readInt(value);
+            CHECK(!"no exception");
+        } catch (const std::invalid_argument &e) {
+            CHECK(std::string(e.what()).size() < 64);
+        }
+        close(fd);
+    }
+
+    // The smallest output buffer holds exactly one value.
+    void extremesRoundTrip()
+    {
+        int fds[2];
+        CHECK(pipe(fds) == 0);
+        {
+            OutputBuffer out(fds[1], Runtime::FlushPolicy::WHEN_FULL, 1);
+            out.writeInt(INT_MIN);
+            out.writeInt(INT_MAX);
+            out.writeInt(0);
+        }
+        close(fds[1]);
+
+        InputBuffer in(fds[0]);
+        int value = 0;
+        CHECK(in.readInt(value) && value == INT_MIN);
+        CHECK(in.readInt(value) && value == INT_MAX);
+        CHECK(in.readInt(value) && value == 0);
+        CHECK(!in.readInt(value));
+        close(fds[0]);
+    }
+
+    void endWithoutTrailingSpace()
+    {
+        int fd = pipeWith("1 -23");
+        InputBuffer in(fd);
+        int value = 0;
+        CHECK(in.readInt(value) && value == 1);
+        CHECK(in.readInt(value) && value == -23);
+        CHECK(!in.readInt(value));
+        close(fd);
+    }
+
+    void nonBlocking(int fd)
+    {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    }
+
+    // An incomplete value is not consumed until the whitespace after it
+    // arrives.
+    void tryReadWaitsForWholeValue()
+    {
+        int fds[2];
+        CHECK(pipe(fds) == 0);
+        nonBlocking(fds[0]);
+        InputBuffer in(fds[0]);
+        int value = 0;
+
+        CHECK(in.tryReadInt(value) == Runtime::ReadStatus::WOULD_BLOCK);
+        CHECK(::write(fds[1], "12", 2) == 2);
+        CHECK(in.tryReadInt(value) == Runtime::ReadStatus::WOULD_BLOCK);
+        CHECK(::write(fds[1], "34 ", 3) == 3);
+        CHECK(in.tryReadInt(value) == Runtime::ReadStatus::VALUE);
+        CHECK(value == 1234);
+        CHECK(in.tryReadInt(value) == Runtime::ReadStatus::WOULD_BLOCK);
+
+        close(fds[1]);
+        CHECK(in.tryReadInt(value) == Runtime::ReadStatus::END);
+        close(fds[0]);
+    }
+
+    // tryWriteInt() refuses values once the pipe and the buffer are both
+    // full; flush() then waits for the reader instead of dropping them.
+    void flushWaitsForFullPipe()
+    {
+        int fds[2];
+        CHECK(pipe(fds) == 0);
+        nonBlocking(fds[1]);
+
+        int written = 0;
+        {
+            OutputBuffer out(fds[1], Runtime::FlushPolicy::WHEN_FULL, 1024);
+            while (out.tryWriteInt(written))
+                written++;
+            CHECK(written > 0);
+
+            std::thread reader([&] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                InputBuffer in(fds[0]);
+                int value, expected = 0;
+                while (in.readInt(value))
+                    CHECK(value == expected++);
+                CHECK(expected == written);
+            });
+
+            out.flush();
+            close(fds[1]);
+            reader.join();
+        }
+        close(fds[0]);
+    }
+}
+
+int main()
+{
+    valueSplitAcrossRefill();
+    signs();
+    longTokens();
+    extremesRoundTrip();
+    endWithoutTrailingSpace();
+    tryReadWaitsForWholeValue();
+    flushWaitsForFullPipe();
+    return Tests::result();
+}
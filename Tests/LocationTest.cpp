@@ -0,0 +1,81 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#include "Check.hpp"
+#include "../Parser/Location.hpp"
+#include "../Parser/Diagnostics.hpp"
+#include <cstring>
+#include <sstream>
+
+using namespace Parser;
+
+namespace {
+
+    // Lines start at offsets 0, 3, 6 and 9. From offset 6 on, positions
+    // are reported as generated from line 100, column 5 of gen.pl0.
+    void load(SourceFile &file)
+    {
+        const char text[] = "ab\ncd\nef\ngh\n";
+        std::vector<std::byte> content(sizeof text - 1);
+        std::memcpy(content.data(), text, content.size());
+        file.setLinesForContent(content);
+        file.addLineColumnInfo(6, "gen.pl0", 100, 5);
+    }
+
+    bool is(const LineInfo &info, const char *filename, int line, int column)
+    {
+        return info.filename == filename && info.line == line &&
+               info.column == column;
+    }
+
+    void unpacksOffsets()
+    {
+        SourceFile file("a.pl0", 0, 12);
+        load(file);
+
+        // The name must survive being unpacked more than once.
+        CHECK(is(file.unpack(4, false), "a.pl0", 2, 2));
+        CHECK(is(file.unpack(4, false), "a.pl0", 2, 2));
+
+        CHECK(is(file.unpack(4, true), "a.pl0", 2, 2));
+        CHECK(is(file.unpack(7, false), "a.pl0", 3, 2));
+        CHECK(is(file.unpack(7, true), "gen.pl0", 100, 6));
+        CHECK(is(file.unpack(10, true), "gen.pl0", 101, 2));
+    }
+
+    void flushesInSourceOrder()
+    {
+        SourceFile file("a.pl0", 0, 12);
+        load(file);
+
+        Diagnostics diagnostics;
+        diagnostics.error(7, "late");
+        diagnostics.error(1, "first");
+        diagnostics.warning(NO_POSITION, "nowhere");
+        diagnostics.error(1, "second");
+        diagnostics.warning(0, "start");
+
+        std::ostringstream os;
+        diagnostics.flush(os, file);
+        CHECK(os.str() ==
+              "a.pl0: warning: nowhere\n"
+              "a.pl0:1:1: warning: start\n"
+              "a.pl0:1:2: error: first\n"
+              "a.pl0:1:2: error: second\n"
+              "gen.pl0:100:6: error: late\n");
+        CHECK(diagnostics.getErrorCount() == 3);
+        CHECK(diagnostics.getWarningCount() == 2);
+
+        std::ostringstream again;
+        diagnostics.flush(again, file);
+        CHECK(again.str().empty());
+    }
+}
+
+int main()
+{
+    unpacksOffsets();
+    flushesInSourceOrder();
+    return Tests::result();
+}
@@ -0,0 +1,77 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#include "Check.hpp"
+#include "Builders.hpp"
+#include <sstream>
+
+using namespace AST;
+using namespace Tests;
+
+namespace {
+
+    // BEGIN
+    //     x := 1;
+    //     IF x THEN
+    //         WHILE x < 3 DO
+    //             BEGIN x := x + 1; WRITE -x END
+    // END
+    Procedure program()
+    {
+        auto loop = std::make_unique<BlockStatement>(statements(
+                std::make_unique<AssignmentStatement>(
+                        "x", std::make_unique<BinaryExpression>(
+                                var("x"), num(1), "+")),
+                std::make_unique<WriteStatement>(
+                        std::make_unique<UnaryExpression>(var("x"), "-"))));
+
+        return {"main", statements(std::make_unique<BlockStatement>(statements(
+                std::make_unique<AssignmentStatement>("x", num(1)),
+                std::make_unique<IfStatement>(
+                        var("x"),
+                        std::make_unique<WhileStatement>(
+                                std::make_unique<BinaryExpression>(
+                                        var("x"), num(3), "<"),
+                                std::move(loop))))))};
+    }
+}
+
+int main()
+{
+    Procedure p = program();
+
+    CHECK(p.toString() ==
+          "procedure main {\n"
+          "    BEGIN\n"
+          "        x = 1\n"
+          "        IF x THEN\n"
+          "            WHILE x < 3 DO\n"
+          "                BEGIN\n"
+          "                    x = x + 1\n"
+          "                    WRITE -x\n"
+          "                END\n"
+          "    END\n"
+          "}");
+
+    std::ostringstream json;
+    p.dump(json);
+    CHECK(json.str() ==
+          R"({"kind":"Procedure","name":"main","statements":[)"
+          R"({"kind":"Block","statements":[)"
+          R"({"kind":"Assignment","name":"x",)"
+          R"("expression":{"kind":"Constant","value":1}},)"
+          R"({"kind":"If","condition":{"kind":"Variable","name":"x"},)"
+          R"("then":{"kind":"While","condition":{"kind":"Binary","op":"<",)"
+          R"("left":{"kind":"Variable","name":"x"},)"
+          R"("right":{"kind":"Constant","value":3}},)"
+          R"("statement":{"kind":"Block","statements":[)"
+          R"({"kind":"Assignment","name":"x",)"
+          R"("expression":{"kind":"Binary","op":"+",)"
+          R"("left":{"kind":"Variable","name":"x"},)"
+          R"("right":{"kind":"Constant","value":1}}},)"
+          R"({"kind":"Write","expression":{"kind":"Unary","op":"-",)"
+          R"("expression":{"kind":"Variable","name":"x"}}}]}}}]}]})");
+
+    return Tests::result();
+}
@@ -0,0 +1,76 @@
+//
+// Created by user on 19-October-2026.
+//
+
+#include "Check.hpp"
+#include "../Symbol/Type.hpp"
+#include <climits>
+
+using namespace Symbol;
+
+namespace {
+
+    std::unique_ptr<Type> array(int lower, int upper,
+                                std::unique_ptr<Type> element)
+    {
+        return std::make_unique<ProductType>(SubrangeType(lower, upper),
+                                             std::move(element));
+    }
+
+    void counts()
+    {
+        CHECK(SubrangeType(5, 5).getCount() == 1);
+        CHECK(SubrangeType(-3, 3).getCount() == 7);
+        CHECK(SubrangeType(INT_MIN, INT_MAX).getCount() ==
+              std::int64_t{1} << 32);
+    }
+
+    // [-3..3] of [1..2]: seven rows of two slots.
+    void nestedArrays()
+    {
+        ProductType matrix(SubrangeType(-3, 3),
+                           array(1, 2, std::make_unique<Type>()));
+
+        CHECK(matrix.getSize() == 14);
+        CHECK(matrix.getElementType().getSize() == 2);
+        CHECK(matrix.offsetOf(-3) == 0);
+        CHECK(matrix.offsetOf(3) == 12);
+    }
+
+    void rejectsBadArrays()
+    {
+        bool tooLarge = false;
+        try {
+            ProductType huge(SubrangeType(0, 70000),
+                             array(0, 70000, std::make_unique<Type>()));
+        } catch (const std::length_error &) {
+            tooLarge = true;
+        }
+        CHECK(tooLarge);
+
+        bool fullRange = false;
+        try {
+            ProductType huge(SubrangeType(INT_MIN, INT_MAX),
+                             std::make_unique<Type>());
+        } catch (const std::length_error &) {
+            fullRange = true;
+        }
+        CHECK(fullRange);
+
+        bool noElement = false;
+        try {
+            ProductType empty(SubrangeType(0, 1), nullptr);
+        } catch (const std::invalid_argument &) {
+            noElement = true;
+        }
+        CHECK(noElement);
+    }
+}
+
+int main()
+{
+    counts();
+    nestedArrays();
+    rejectsBadArrays();
+    return Tests::result();
+}